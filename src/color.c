@@ -0,0 +1,258 @@
+/* JPEG GPU project
+Copyright (c) 2014-2016 JPEG GPU project contributors.  All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ use this file except in compliance with the License.
+You may obtain a copy of the License at:
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed
+ under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+ CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and limitations
+ under the License. */
+
+
+#include <stdlib.h>
+#include "color.h"
+#include "internal.h"
+
+#if defined(GLJ_HAVE_SSE2)
+# include <emmintrin.h>
+#endif
+
+const int GLJ_PIXEL_SIZE[GLJ_PIXEL_FORMAT_MAX] = {
+  3,
+  4,
+  4
+};
+
+/* The offsets of red, green, blue and alpha in a pixel of each format */
+static const unsigned char GLJ_PIXEL_OFFSETS[GLJ_PIXEL_FORMAT_MAX][4] = {
+  { 0, 1, 2, 3 },
+  { 0, 1, 2, 3 },
+  { 2, 1, 0, 3 }
+};
+
+/* The constants of libjpeg's jdcolor.c, with 16 fractional bits */
+#define GLJ_YCC_SCALEBITS (16)
+#define GLJ_YCC_ONE_HALF (1L << (GLJ_YCC_SCALEBITS - 1))
+#define GLJ_YCC_FIX(x) ((long)((x)*(1L << GLJ_YCC_SCALEBITS) + 0.5))
+
+#define GLJ_YCC_CR_R GLJ_YCC_FIX(1.40200)
+#define GLJ_YCC_CB_B GLJ_YCC_FIX(1.77200)
+#define GLJ_YCC_CB_G GLJ_YCC_FIX(0.34414)
+#define GLJ_YCC_CR_G GLJ_YCC_FIX(0.71414)
+
+void glj_ycc_rgb_rows(unsigned char *x, int xstride, const unsigned char *y,
+ int ystride, int nrows, const unsigned char *cb, const unsigned char *cr,
+ int cdec, int width, glj_pixel_format format) {
+  const unsigned char *off;
+  int size;
+  int c;
+  off = GLJ_PIXEL_OFFSETS[format];
+  size = GLJ_PIXEL_SIZE[format];
+  for (c = 0; c << cdec < width; c++) {
+    long u;
+    long v;
+    int red;
+    int green;
+    int blue;
+    int i;
+    int k;
+    u = cb[c] - 128;
+    v = cr[c] - 128;
+    red = (int)((GLJ_YCC_CR_R*v + GLJ_YCC_ONE_HALF) >> GLJ_YCC_SCALEBITS);
+    green = (int)((-GLJ_YCC_CB_G*u - GLJ_YCC_CR_G*v + GLJ_YCC_ONE_HALF) >>
+     GLJ_YCC_SCALEBITS);
+    blue = (int)((GLJ_YCC_CB_B*u + GLJ_YCC_ONE_HALF) >> GLJ_YCC_SCALEBITS);
+    /* Every luma sample the chroma sample covers takes the same terms */
+    for (i = c << cdec; i < width && i < (c + 1) << cdec; i++) {
+      for (k = 0; k < nrows; k++) {
+        unsigned char *p;
+        int l;
+        p = x + k*xstride + i*size;
+        l = y[k*ystride + i];
+        p[off[0]] = GLJ_CLAMP255(l + red);
+        p[off[1]] = GLJ_CLAMP255(l + green);
+        p[off[2]] = GLJ_CLAMP255(l + blue);
+        if (size == 4) {
+          p[off[3]] = 255;
+        }
+      }
+    }
+  }
+}
+
+#if defined(GLJ_HAVE_SSE2)
+
+/* A pair of 16-bit constants for _mm_madd_epi16() */
+# define GLJ_YCC_PAIR(a, b) _mm_set_epi16(b, a, b, a, b, a, b, a)
+
+/* The red, green and blue terms of 8 chroma samples u and v, less 128.
+   Constants that do not fit in 16 bits are split into a multiple of
+    2^GLJ_YCC_SCALEBITS, which is added after the shift, and the remainder.
+    The rounding constant is multiplied in as a pair with the samples. */
+static void glj_ycc_terms_sse2(__m128i t[3], __m128i u, __m128i v) {
+  __m128i r_const;
+  __m128i g_const;
+  __m128i b_const;
+  __m128i two;
+  __m128i half;
+  __m128i lo;
+  __m128i hi;
+  r_const = GLJ_YCC_PAIR(GLJ_YCC_CR_R - (1L << GLJ_YCC_SCALEBITS),
+   GLJ_YCC_ONE_HALF >> 1);
+  g_const = GLJ_YCC_PAIR(-GLJ_YCC_CB_G,
+   (1L << GLJ_YCC_SCALEBITS) - GLJ_YCC_CR_G);
+  b_const = GLJ_YCC_PAIR(GLJ_YCC_CB_B - (2L << GLJ_YCC_SCALEBITS),
+   GLJ_YCC_ONE_HALF >> 1);
+  two = _mm_set1_epi16(2);
+  half = _mm_set1_epi32(GLJ_YCC_ONE_HALF);
+  lo = _mm_madd_epi16(_mm_unpacklo_epi16(v, two), r_const);
+  hi = _mm_madd_epi16(_mm_unpackhi_epi16(v, two), r_const);
+  t[0] = _mm_add_epi16(_mm_packs_epi32(_mm_srai_epi32(lo, GLJ_YCC_SCALEBITS),
+   _mm_srai_epi32(hi, GLJ_YCC_SCALEBITS)), v);
+  lo = _mm_add_epi32(_mm_madd_epi16(_mm_unpacklo_epi16(u, v), g_const), half);
+  hi = _mm_add_epi32(_mm_madd_epi16(_mm_unpackhi_epi16(u, v), g_const), half);
+  t[1] = _mm_sub_epi16(_mm_packs_epi32(_mm_srai_epi32(lo, GLJ_YCC_SCALEBITS),
+   _mm_srai_epi32(hi, GLJ_YCC_SCALEBITS)), v);
+  lo = _mm_madd_epi16(_mm_unpacklo_epi16(u, two), b_const);
+  hi = _mm_madd_epi16(_mm_unpackhi_epi16(u, two), b_const);
+  t[2] = _mm_add_epi16(_mm_packs_epi32(_mm_srai_epi32(lo, GLJ_YCC_SCALEBITS),
+   _mm_srai_epi32(hi, GLJ_YCC_SCALEBITS)), _mm_add_epi16(u, u));
+}
+
+/* Drop the fourth byte of each of the 4 pixels in p, leaving 12 bytes. */
+static __m128i glj_pack_rgb_sse2(__m128i p) {
+  __m128i lo;
+  __m128i hi;
+  lo = _mm_and_si128(p, _mm_set_epi32(0, 0x00FFFFFF, 0, 0x00FFFFFF));
+  hi = _mm_and_si128(p, _mm_set_epi32(0x00FFFFFF, 0, 0x00FFFFFF, 0));
+  p = _mm_or_si128(lo, _mm_srli_epi64(hi, 8));
+  return _mm_or_si128(
+   _mm_and_si128(p, _mm_set_epi32(0, 0, 0x0000FFFF, (int)0xFFFFFFFF)),
+   _mm_and_si128(_mm_srli_si128(p, 2),
+   _mm_set_epi32(0, (int)0xFFFFFFFF, (int)0xFFFF0000, 0)));
+}
+
+/* Store 16 pixels from the 16 samples of each channel. */
+static void glj_store_pixels_sse2(unsigned char *x, __m128i r, __m128i g,
+ __m128i b, glj_pixel_format format) {
+  __m128i a;
+  __m128i lo;
+  __m128i hi;
+  __m128i p[4];
+  if (format == GLJ_PIXEL_BGRA) {
+    a = r;
+    r = b;
+    b = a;
+  }
+  a = _mm_set1_epi8((char)0xFF);
+  lo = _mm_unpacklo_epi8(r, g);
+  hi = _mm_unpacklo_epi8(b, a);
+  p[0] = _mm_unpacklo_epi16(lo, hi);
+  p[1] = _mm_unpackhi_epi16(lo, hi);
+  lo = _mm_unpackhi_epi8(r, g);
+  hi = _mm_unpackhi_epi8(b, a);
+  p[2] = _mm_unpacklo_epi16(lo, hi);
+  p[3] = _mm_unpackhi_epi16(lo, hi);
+  if (format == GLJ_PIXEL_RGB) {
+    p[0] = glj_pack_rgb_sse2(p[0]);
+    p[1] = glj_pack_rgb_sse2(p[1]);
+    p[2] = glj_pack_rgb_sse2(p[2]);
+    p[3] = glj_pack_rgb_sse2(p[3]);
+    _mm_storeu_si128((__m128i *)x,
+     _mm_or_si128(p[0], _mm_slli_si128(p[1], 12)));
+    _mm_storeu_si128((__m128i *)(x + 16),
+     _mm_or_si128(_mm_srli_si128(p[1], 4), _mm_slli_si128(p[2], 8)));
+    _mm_storeu_si128((__m128i *)(x + 32),
+     _mm_or_si128(_mm_srli_si128(p[2], 8), _mm_slli_si128(p[3], 4)));
+  }
+  else {
+    _mm_storeu_si128((__m128i *)x, p[0]);
+    _mm_storeu_si128((__m128i *)(x + 16), p[1]);
+    _mm_storeu_si128((__m128i *)(x + 32), p[2]);
+    _mm_storeu_si128((__m128i *)(x + 48), p[3]);
+  }
+}
+
+void glj_ycc_rgb_rows_sse2(unsigned char *x, int xstride,
+ const unsigned char *y, int ystride, int nrows, const unsigned char *cb,
+ const unsigned char *cr, int cdec, int width, glj_pixel_format format) {
+  __m128i zero;
+  __m128i bias;
+  int size;
+  int i;
+  if (cdec > 1) {
+    glj_ycc_rgb_rows(x, xstride, y, ystride, nrows, cb, cr, cdec, width,
+     format);
+    return;
+  }
+  zero = _mm_setzero_si128();
+  bias = _mm_set1_epi16(128);
+  size = GLJ_PIXEL_SIZE[format];
+  for (i = 0; i + 16 <= width; i += 16) {
+    __m128i lo[3];
+    __m128i hi[3];
+    __m128i u;
+    __m128i v;
+    int j;
+    int k;
+    /* The terms for 16 luma samples, from 8 chroma samples replicated when
+        they are subsampled, or 16 */
+    u = _mm_loadl_epi64((const __m128i *)(cb + (i >> cdec)));
+    v = _mm_loadl_epi64((const __m128i *)(cr + (i >> cdec)));
+    glj_ycc_terms_sse2(lo, _mm_sub_epi16(_mm_unpacklo_epi8(u, zero), bias),
+     _mm_sub_epi16(_mm_unpacklo_epi8(v, zero), bias));
+    if (cdec) {
+      for (j = 0; j < 3; j++) {
+        hi[j] = _mm_unpackhi_epi16(lo[j], lo[j]);
+        lo[j] = _mm_unpacklo_epi16(lo[j], lo[j]);
+      }
+    }
+    else {
+      u = _mm_loadl_epi64((const __m128i *)(cb + i + 8));
+      v = _mm_loadl_epi64((const __m128i *)(cr + i + 8));
+      glj_ycc_terms_sse2(hi, _mm_sub_epi16(_mm_unpacklo_epi8(u, zero), bias),
+       _mm_sub_epi16(_mm_unpacklo_epi8(v, zero), bias));
+    }
+    for (k = 0; k < nrows; k++) {
+      __m128i l;
+      __m128i llo;
+      __m128i lhi;
+      __m128i c[3];
+      l = _mm_loadu_si128((const __m128i *)(y + k*ystride + i));
+      llo = _mm_unpacklo_epi8(l, zero);
+      lhi = _mm_unpackhi_epi8(l, zero);
+      for (j = 0; j < 3; j++) {
+        c[j] = _mm_packus_epi16(_mm_add_epi16(llo, lo[j]),
+         _mm_add_epi16(lhi, hi[j]));
+      }
+      glj_store_pixels_sse2(x + k*xstride + i*size, c[0], c[1], c[2], format);
+    }
+  }
+  if (i < width) {
+    glj_ycc_rgb_rows(x + i*size, xstride, y + i, ystride, nrows,
+     cb + (i >> cdec), cr + (i >> cdec), cdec, width - i, format);
+  }
+}
+
+#endif
+
+void glj_grey_rgb_row(unsigned char *x, const unsigned char *y, int width,
+ glj_pixel_format format) {
+  int size;
+  int i;
+  size = GLJ_PIXEL_SIZE[format];
+  for (i = 0; i < width; i++) {
+    x[0] = y[i];
+    x[1] = y[i];
+    x[2] = y[i];
+    if (size == 4) {
+      x[3] = 255;
+    }
+    x += size;
+  }
+}
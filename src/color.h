@@ -0,0 +1,57 @@
+/* JPEG GPU project
+Copyright (c) 2014-2016 JPEG GPU project contributors.  All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ use this file except in compliance with the License.
+You may obtain a copy of the License at:
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed
+ under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+ CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and limitations
+ under the License. */
+
+
+#if !defined(_color_H)
+# define _color_H (1)
+
+# if defined(__SSE2__)
+#  define GLJ_HAVE_SSE2 (1)
+# endif
+
+typedef enum glj_pixel_format {
+  GLJ_PIXEL_RGB,
+  GLJ_PIXEL_RGBA,
+  GLJ_PIXEL_BGRA,
+  GLJ_PIXEL_FORMAT_MAX
+} glj_pixel_format;
+
+/* The number of bytes in a pixel of each format */
+extern const int GLJ_PIXEL_SIZE[GLJ_PIXEL_FORMAT_MAX];
+
+/* Convert width samples of nrows rows of luma y, ystride apart, that share
+    the row of chroma cb and cr subsampled horizontally by 2^cdec, to pixels
+    of format with a stride of xstride.
+   The color conversion uses the fixed point arithmetic of libjpeg, and the
+    chroma is replicated as libjpeg's merged upsampling does, so the pixels
+    are those of libjpeg with do_fancy_upsampling off. */
+void glj_ycc_rgb_rows(unsigned char *x, int xstride, const unsigned char *y,
+ int ystride, int nrows, const unsigned char *cb, const unsigned char *cr,
+ int cdec, int width, glj_pixel_format format);
+
+# if defined(GLJ_HAVE_SSE2)
+void glj_ycc_rgb_rows_sse2(unsigned char *x, int xstride,
+ const unsigned char *y, int ystride, int nrows, const unsigned char *cb,
+ const unsigned char *cr, int cdec, int width, glj_pixel_format format);
+#  define GLJ_YCC_RGB_ROWS glj_ycc_rgb_rows_sse2
+# else
+#  define GLJ_YCC_RGB_ROWS glj_ycc_rgb_rows
+# endif
+
+/* Convert width samples of a row of luma y to grey pixels of format. */
+void glj_grey_rgb_row(unsigned char *x, const unsigned char *y, int width,
+ glj_pixel_format format);
+
+#endif
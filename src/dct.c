@@ -16,6 +16,10 @@ See the License for the specific language governing permissions and limitations
 #include <math.h>
 #include "dct.h"
 
+#if defined(GLJ_HAVE_SSE2)
+# include <emmintrin.h>
+#endif
+
 typedef float glj_real;
 
 static void glj_real_idct8(glj_real *x, int xstride, const glj_real y[8]) {
@@ -86,15 +90,24 @@ static void glj_real_idct8(glj_real *x, int xstride, const glj_real y[8]) {
   x[7*xstride] = u7;
 }
 
+#define GLJ_REAL_IDCT8_S0 (0.35355339059327376220042218105242)
+#define GLJ_REAL_IDCT8_S1 (0.49039264020161522456309111806712)
+#define GLJ_REAL_IDCT8_S2 (0.46193976625564337806409159469839)
+#define GLJ_REAL_IDCT8_S3 (0.41573480615127261853939418880895)
+#define GLJ_REAL_IDCT8_S4 (0.35355339059327376220042218105242)
+#define GLJ_REAL_IDCT8_S5 (0.27778511650980111237141540697427)
+#define GLJ_REAL_IDCT8_S6 (0.19134171618254488586422999201520)
+#define GLJ_REAL_IDCT8_S7 (0.097545161008064133924142434238511)
+
 static const glj_real GLJ_REAL_IDCT8_SCALES[8] = {
-  0.35355339059327376220042218105242,
-  0.49039264020161522456309111806712,
-  0.46193976625564337806409159469839,
-  0.41573480615127261853939418880895,
-  0.35355339059327376220042218105242,
-  0.27778511650980111237141540697427,
-  0.19134171618254488586422999201520,
-  0.097545161008064133924142434238511,
+  GLJ_REAL_IDCT8_S0,
+  GLJ_REAL_IDCT8_S1,
+  GLJ_REAL_IDCT8_S2,
+  GLJ_REAL_IDCT8_S3,
+  GLJ_REAL_IDCT8_S4,
+  GLJ_REAL_IDCT8_S5,
+  GLJ_REAL_IDCT8_S6,
+  GLJ_REAL_IDCT8_S7
 };
 
 void glj_real_idct8x8(short *x, int xstride, const short *y, int ystride) {
@@ -119,3 +132,603 @@ void glj_real_idct8x8(short *x, int xstride, const short *y, int ystride) {
     }
   }
 }
+
+/* The sparse variants of glj_real_idct8x8() take blocks whose only nonzero
+    coefficients lie in the top-left NxN corner and skip the arithmetic on the
+    zero ones.
+   Adding or multiplying by an exact zero does not round, so what remains of
+    each sum is evaluated in the same order and the samples are identical to
+    those of the full transform. */
+
+/* glj_real_idct8() of a row with only y[0] and y[1] nonzero. */
+static void glj_real_idct8_2(glj_real *x, int xstride, const glj_real y[2]) {
+  glj_real t0;
+  glj_real t4;
+  glj_real t5;
+  glj_real t6;
+  glj_real t7;
+  glj_real u4;
+  glj_real u5;
+  glj_real u8;
+  t0 = y[0];
+  t7 = y[1];
+  u5 = t7*((glj_real)1.4142135623730950488016887242097);
+  u8 = t7*((glj_real)1.8477590650225735122563663787936);
+  u4 = u8 - t7*((glj_real)1.0823922002923939687994464107328);
+  t6 = t7 - u8;
+  t5 = t6 + u5;
+  t4 = t5 - u4;
+  x[0*xstride] = t0 + t7;
+  x[1*xstride] = t0 - t6;
+  x[2*xstride] = t0 + t5;
+  x[3*xstride] = t0 - t4;
+  x[4*xstride] = t0 + t4;
+  x[5*xstride] = t0 - t5;
+  x[6*xstride] = t0 + t6;
+  x[7*xstride] = t0 - t7;
+}
+
+/* glj_real_idct8() of a row with only y[0] through y[3] nonzero. */
+static void glj_real_idct8_4(glj_real *x, int xstride, const glj_real y[4]) {
+  glj_real t0;
+  glj_real t1;
+  glj_real t2;
+  glj_real t3;
+  glj_real t4;
+  glj_real t5;
+  glj_real t6;
+  glj_real t7;
+  glj_real u2;
+  glj_real u4;
+  glj_real u5;
+  glj_real u6;
+  glj_real u7;
+  glj_real u8;
+  t0 = y[0];
+  u4 = y[1];
+  t2 = y[2];
+  u6 = y[3];
+  u2 = t2*((glj_real)1.4142135623730950488016887242097) - t2;
+  t3 = t0 - t2;
+  t1 = t0 + u2;
+  t2 = t0 - u2;
+  t0 = t0 + y[2];
+  u7 = u4 + u6;
+  u5 = (u4 - u6)*((glj_real)1.4142135623730950488016887242097);
+  u8 = (u4 - u6)*((glj_real)1.8477590650225735122563663787936);
+  u4 = u8 - u4*((glj_real)1.0823922002923939687994464107328);
+  u6 = u8 + u6*((glj_real)2.6131259297527530557132863468544);
+  t7 = u7;
+  t6 = t7 - u6;
+  t5 = t6 + u5;
+  t4 = t5 - u4;
+  x[0*xstride] = t0 + t7;
+  x[1*xstride] = t1 - t6;
+  x[2*xstride] = t2 + t5;
+  x[3*xstride] = t3 - t4;
+  x[4*xstride] = t3 + t4;
+  x[5*xstride] = t2 - t5;
+  x[6*xstride] = t1 + t6;
+  x[7*xstride] = t0 - t7;
+}
+
+/* Only x[0] is written, as every sample of a DC-only block has its value. */
+void glj_real_idct8x8_dc(short *x, const short *y) {
+  glj_real t;
+  t = y[0]*GLJ_REAL_IDCT8_SCALES[0]*GLJ_REAL_IDCT8_SCALES[0];
+  t += 0.5;
+  x[0] = (short)floor(t);
+}
+
+void glj_real_idct8x8_2x2(short *x, int xstride, const short *y, int ystride) {
+  int j;
+  int i;
+  glj_real t[8*8];
+  glj_real z[8*2];
+  for (j = 0; j < 2; j++) {
+    for (i = 0; i < 2; i++) {
+      t[j*2 + i] =
+       y[j*ystride + i]*GLJ_REAL_IDCT8_SCALES[j]*GLJ_REAL_IDCT8_SCALES[i];
+    }
+  }
+  for (i = 0; i < 2; i++) glj_real_idct8_2(z + i, 2, t + 2*i);
+  for (i = 0; i < 8; i++) {
+    z[2*i] += 0.5;
+    glj_real_idct8_2(t + i, 8, z + 2*i);
+  }
+  for (j = 0; j < 8; j++) {
+    for (i = 0; i < 8; i++) {
+      x[j*xstride + i] = (short)floor(t[j*8 + i]);
+    }
+  }
+}
+
+void glj_real_idct8x8_4x4(short *x, int xstride, const short *y, int ystride) {
+  int j;
+  int i;
+  glj_real t[8*8];
+  glj_real z[8*4];
+  for (j = 0; j < 4; j++) {
+    for (i = 0; i < 4; i++) {
+      t[j*4 + i] =
+       y[j*ystride + i]*GLJ_REAL_IDCT8_SCALES[j]*GLJ_REAL_IDCT8_SCALES[i];
+    }
+  }
+  for (i = 0; i < 4; i++) glj_real_idct8_4(z + i, 4, t + 4*i);
+  for (i = 0; i < 8; i++) {
+    z[4*i] += 0.5;
+    glj_real_idct8_4(t + i, 8, z + 4*i);
+  }
+  for (j = 0; j < 8; j++) {
+    for (i = 0; i < 8; i++) {
+      x[j*xstride + i] = (short)floor(t[j*8 + i]);
+    }
+  }
+}
+
+/* The batched inverse DCT of glj_real_idct8x8_store() holds each value of
+    the transform in a row of GLJ_IDCT_BATCH_MAX lanes, one for each block,
+    and runs the butterflies of glj_real_idct8() across all of them, so the
+    loops over the lanes can be vectorized as wide as the target allows. */
+typedef glj_real glj_real_lanes[GLJ_IDCT_BATCH_MAX];
+
+/* GLJ_REAL_IDCT8_SCALES of the row and column of each coefficient */
+#define GLJ_REAL_IDCT8_ROW(s) s, s, s, s, s, s, s, s
+#define GLJ_REAL_IDCT8_COL \
+ GLJ_REAL_IDCT8_S0, GLJ_REAL_IDCT8_S1, GLJ_REAL_IDCT8_S2, GLJ_REAL_IDCT8_S3, \
+ GLJ_REAL_IDCT8_S4, GLJ_REAL_IDCT8_S5, GLJ_REAL_IDCT8_S6, GLJ_REAL_IDCT8_S7
+
+static const glj_real GLJ_REAL_IDCT8_ROW_SCALES[8*8] = {
+  GLJ_REAL_IDCT8_ROW(GLJ_REAL_IDCT8_S0), GLJ_REAL_IDCT8_ROW(GLJ_REAL_IDCT8_S1),
+  GLJ_REAL_IDCT8_ROW(GLJ_REAL_IDCT8_S2), GLJ_REAL_IDCT8_ROW(GLJ_REAL_IDCT8_S3),
+  GLJ_REAL_IDCT8_ROW(GLJ_REAL_IDCT8_S4), GLJ_REAL_IDCT8_ROW(GLJ_REAL_IDCT8_S5),
+  GLJ_REAL_IDCT8_ROW(GLJ_REAL_IDCT8_S6), GLJ_REAL_IDCT8_ROW(GLJ_REAL_IDCT8_S7)
+};
+
+static const glj_real GLJ_REAL_IDCT8_COL_SCALES[8*8] = {
+  GLJ_REAL_IDCT8_COL, GLJ_REAL_IDCT8_COL, GLJ_REAL_IDCT8_COL,
+  GLJ_REAL_IDCT8_COL, GLJ_REAL_IDCT8_COL, GLJ_REAL_IDCT8_COL,
+  GLJ_REAL_IDCT8_COL, GLJ_REAL_IDCT8_COL
+};
+
+static void glj_real_idct8_lanes(glj_real_lanes *x, int xstride,
+ glj_real_lanes *y) {
+  glj_real_lanes r[8];
+  int k;
+  int i;
+  /* Writing the results to a local copy first tells the compiler that the
+      lanes of x and y do not alias */
+  for (k = 0; k < GLJ_IDCT_BATCH_MAX; k++) {
+    glj_real t0;
+    glj_real t1;
+    glj_real t2;
+    glj_real t3;
+    glj_real t4;
+    glj_real t5;
+    glj_real t6;
+    glj_real t7;
+    glj_real u0;
+    glj_real u1;
+    glj_real u2;
+    glj_real u3;
+    glj_real u4;
+    glj_real u5;
+    glj_real u6;
+    glj_real u7;
+    glj_real u8;
+    t0 = y[0][k];
+    u4 = y[1][k];
+    t2 = y[2][k];
+    u6 = y[3][k];
+    t1 = y[4][k];
+    u5 = y[5][k];
+    t3 = y[6][k];
+    u7 = y[7][k];
+    u0 = t0 + t1;
+    u1 = t0 - t1;
+    u3 = t2 + t3;
+    u2 = (t2 - t3)*((glj_real)1.4142135623730950488016887242097) - u3;
+    t0 = u0 + u3;
+    t3 = u0 - u3;
+    t1 = u1 + u2;
+    t2 = u1 - u2;
+    t5 = u5 + u6;
+    t6 = u5 - u6;
+    t7 = u4 + u7;
+    t4 = u4 - u7;
+    u7 = t7 + t5;
+    u5 = (t7 - t5)*((glj_real)1.4142135623730950488016887242097);
+    u8 = (t4 + t6)*((glj_real)1.8477590650225735122563663787936);
+    u4 = u8 - t4*((glj_real)1.0823922002923939687994464107328);
+    u6 = u8 - t6*((glj_real)2.6131259297527530557132863468544);
+    t7 = u7;
+    t6 = t7 - u6;
+    t5 = t6 + u5;
+    t4 = t5 - u4;
+    r[0][k] = t0 + t7;
+    r[1][k] = t1 - t6;
+    r[2][k] = t2 + t5;
+    r[3][k] = t3 - t4;
+    r[4][k] = t3 + t4;
+    r[5][k] = t2 - t5;
+    r[6][k] = t1 + t6;
+    r[7][k] = t0 - t7;
+  }
+  for (i = 0; i < 8; i++) {
+    for (k = 0; k < GLJ_IDCT_BATCH_MAX; k++) x[i*xstride][k] = r[i][k];
+  }
+}
+
+/* Both passes of the batched inverse DCT of the scaled coefficients in t,
+    adding bias to every output before it is rounded down. */
+static void glj_real_idct8x8_lanes(glj_real_lanes t[8*8], glj_real bias) {
+  int i;
+  int k;
+  glj_real_lanes z[8*8];
+  for (i = 0; i < 8; i++) glj_real_idct8_lanes(z + i, 8, t + 8*i);
+  for (i = 0; i < 8; i++) {
+    for (k = 0; k < GLJ_IDCT_BATCH_MAX; k++) z[8*i][k] += bias;
+    glj_real_idct8_lanes(t + i, 8, z + 8*i);
+  }
+}
+
+void glj_real_idct8x8_prescale(float *scaled, const unsigned short *tbl) {
+  int j;
+  for (j = 0; j < 8*8; j++) {
+    scaled[j] =
+     tbl[j]*GLJ_REAL_IDCT8_ROW_SCALES[j]*GLJ_REAL_IDCT8_COL_SCALES[j];
+  }
+}
+
+void glj_real_idct8x8_store(unsigned char *const *x, const int *xstride,
+ const short *const *y, const float *const *scaled, int nblocks) {
+  int j;
+  int i;
+  int k;
+  glj_real_lanes t[8*8];
+  unsigned char s[8*8][GLJ_IDCT_BATCH_MAX];
+  for (k = 0; k < nblocks; k++) {
+    glj_real f[8*8];
+    for (j = 0; j < 8*8; j++) f[j] = y[k][j]*scaled[k][j];
+    for (j = 0; j < 8*8; j++) t[j][k] = f[j];
+  }
+  for (j = 0; j < 8*8; j++) {
+    for (k = nblocks; k < GLJ_IDCT_BATCH_MAX; k++) t[j][k] = 0;
+  }
+  /* The level shift is added with the rounding, since a constant added to the
+      DC input of the second pass reaches every sample unchanged */
+  glj_real_idct8x8_lanes(t, 128.5);
+  for (j = 0; j < 8*8; j++) {
+    for (k = 0; k < GLJ_IDCT_BATCH_MAX; k++) {
+      int v;
+      v = (int)t[j][k];
+      v -= t[j][k] < v;
+      v = v < 0 ? 0 : v;
+      s[j][k] = (unsigned char)(v > 255 ? 255 : v);
+    }
+  }
+  for (k = 0; k < nblocks; k++) {
+    unsigned char *r;
+    r = x[k];
+    for (j = 0; j < 8*8; j += 8) {
+      for (i = 0; i < 8; i++) r[i] = s[j + i][k];
+      r += xstride[k];
+    }
+  }
+}
+
+/* Scaled inverse 4-point Type-II DCT, the even half of glj_real_idct8().
+   The inputs must be scaled by the GLJ_REAL_IDCT8_SCALES of the frequencies
+    they take the place of, 0, 2, 4 and 6. */
+static void glj_real_idct4(glj_real *x, int xstride, const glj_real y[4]) {
+  glj_real t0;
+  glj_real t1;
+  glj_real t2;
+  glj_real t3;
+  glj_real u0;
+  glj_real u1;
+  glj_real u2;
+  glj_real u3;
+  t0 = y[0];
+  t2 = y[1];
+  t1 = y[2];
+  t3 = y[3];
+  u0 = t0 + t1;
+  u1 = t0 - t1;
+  u3 = t2 + t3;
+  u2 = (t2 - t3)*((glj_real)1.4142135623730950488016887242097) - u3;
+  x[0*xstride] = u0 + u3;
+  x[1*xstride] = u1 + u2;
+  x[2*xstride] = u1 - u2;
+  x[3*xstride] = u0 - u3;
+}
+
+/* The reduced size inverse DCTs take the top-left NxN coefficients of an 8x8
+    block and produce the NxN block of samples it would have if it had been
+    downsampled by 8/N before the forward DCT.
+   An N-point inverse DCT of the first N frequencies with the 8-point
+    normalization is exactly the even part of the 8-point inverse DCT of the
+    same values placed at every 8/N-th frequency, so the 8-point scale
+    factors of those frequencies are reused. */
+void glj_real_idct4x4(short *x, int xstride, const short *y, int ystride) {
+  int j;
+  int i;
+  glj_real t[4*4];
+  glj_real z[4*4];
+  for (j = 0; j < 4; j++) {
+    for (i = 0; i < 4; i++) {
+      t[j*4 + i] = y[j*ystride + i]*GLJ_REAL_IDCT8_SCALES[2*j]*
+       GLJ_REAL_IDCT8_SCALES[2*i];
+    }
+  }
+  for (i = 0; i < 4; i++) glj_real_idct4(z + i, 4, t + 4*i);
+  for (i = 0; i < 4; i++) {
+    z[4*i] += 0.5;
+    glj_real_idct4(t + i, 4, z + 4*i);
+  }
+  for (j = 0; j < 4; j++) {
+    for (i = 0; i < 4; i++) {
+      x[j*xstride + i] = (short)floor(t[j*4 + i]);
+    }
+  }
+}
+
+void glj_real_idct2x2(short *x, int xstride, const short *y, int ystride) {
+  glj_real t0;
+  glj_real t1;
+  glj_real t2;
+  glj_real t3;
+  glj_real u0;
+  glj_real u1;
+  /* The scale factors of frequencies 0 and 4 are both 1/sqrt(8) */
+  t0 = y[0]*((glj_real)0.125) + 0.5;
+  t1 = y[1]*((glj_real)0.125);
+  t2 = y[ystride]*((glj_real)0.125);
+  t3 = y[ystride + 1]*((glj_real)0.125);
+  u0 = t0 + t2;
+  u1 = t0 - t2;
+  t0 = t1 + t3;
+  t1 = t1 - t3;
+  x[0] = (short)floor(u0 + t0);
+  x[1] = (short)floor(u0 - t0);
+  x[xstride] = (short)floor(u1 + t1);
+  x[xstride + 1] = (short)floor(u1 - t1);
+}
+
+void glj_real_idct1x1(short *x, const short *y) {
+  x[0] = (short)floor(y[0]*((glj_real)0.125) + 0.5);
+}
+
+/* The integer inverse DCT of libjpeg's jidctint.c, JDCT_ISLOW, with 13-bit
+    fixed-point constants and PASS1_BITS extra bits of precision kept
+    between the column and row passes. */
+#define GLJ_ISLOW_CONST_BITS (13)
+#define GLJ_ISLOW_PASS1_BITS (2)
+
+#define GLJ_ISLOW_FIX_0_298631336 (2446)
+#define GLJ_ISLOW_FIX_0_390180644 (3196)
+#define GLJ_ISLOW_FIX_0_541196100 (4433)
+#define GLJ_ISLOW_FIX_0_765366865 (6270)
+#define GLJ_ISLOW_FIX_0_899976223 (7373)
+#define GLJ_ISLOW_FIX_1_175875602 (9633)
+#define GLJ_ISLOW_FIX_1_501321110 (12299)
+#define GLJ_ISLOW_FIX_1_847759065 (15137)
+#define GLJ_ISLOW_FIX_1_961570560 (16069)
+#define GLJ_ISLOW_FIX_2_053119869 (16819)
+#define GLJ_ISLOW_FIX_2_562915447 (20995)
+#define GLJ_ISLOW_FIX_3_072711026 (25172)
+
+#define GLJ_ISLOW_DESCALE(x, n) (((x) + (1L << ((n) - 1))) >> (n))
+
+/* The SIMD versions keep the results of both passes in 16 bits, which every
+    valid block fits in, so the portable one saturates them the same way. */
+#define GLJ_ISLOW_SATURATE(x) \
+ ((x) < -32768L ? -32768L : (x) > 32767L ? 32767L : (x))
+
+static void glj_islow_idct8(long x[8], const long y[8]) {
+  long z1;
+  long z2;
+  long z3;
+  long z4;
+  long z5;
+  long tmp0;
+  long tmp1;
+  long tmp2;
+  long tmp3;
+  long tmp10;
+  long tmp11;
+  long tmp12;
+  long tmp13;
+  /* Even part */
+  z2 = y[2];
+  z3 = y[6];
+  z1 = (z2 + z3)*GLJ_ISLOW_FIX_0_541196100;
+  tmp2 = z1 - z3*GLJ_ISLOW_FIX_1_847759065;
+  tmp3 = z1 + z2*GLJ_ISLOW_FIX_0_765366865;
+  tmp0 = (y[0] + y[4])*(1L << GLJ_ISLOW_CONST_BITS);
+  tmp1 = (y[0] - y[4])*(1L << GLJ_ISLOW_CONST_BITS);
+  tmp10 = tmp0 + tmp3;
+  tmp13 = tmp0 - tmp3;
+  tmp11 = tmp1 + tmp2;
+  tmp12 = tmp1 - tmp2;
+  /* Odd part */
+  tmp0 = y[7];
+  tmp1 = y[5];
+  tmp2 = y[3];
+  tmp3 = y[1];
+  z1 = tmp0 + tmp3;
+  z2 = tmp1 + tmp2;
+  z3 = tmp0 + tmp2;
+  z4 = tmp1 + tmp3;
+  z5 = (z3 + z4)*GLJ_ISLOW_FIX_1_175875602;
+  tmp0 *= GLJ_ISLOW_FIX_0_298631336;
+  tmp1 *= GLJ_ISLOW_FIX_2_053119869;
+  tmp2 *= GLJ_ISLOW_FIX_3_072711026;
+  tmp3 *= GLJ_ISLOW_FIX_1_501321110;
+  z1 *= -GLJ_ISLOW_FIX_0_899976223;
+  z2 *= -GLJ_ISLOW_FIX_2_562915447;
+  z3 *= -GLJ_ISLOW_FIX_1_961570560;
+  z4 *= -GLJ_ISLOW_FIX_0_390180644;
+  z3 += z5;
+  z4 += z5;
+  tmp0 += z1 + z3;
+  tmp1 += z2 + z4;
+  tmp2 += z2 + z3;
+  tmp3 += z1 + z4;
+  x[0] = tmp10 + tmp3;
+  x[7] = tmp10 - tmp3;
+  x[1] = tmp11 + tmp2;
+  x[6] = tmp11 - tmp2;
+  x[2] = tmp12 + tmp1;
+  x[5] = tmp12 - tmp1;
+  x[3] = tmp13 + tmp0;
+  x[4] = tmp13 - tmp0;
+}
+
+void glj_islow_idct8x8(short *x, int xstride, const short *y, int ystride) {
+  int j;
+  int i;
+  long t[8];
+  long z[8];
+  short w[8*8];
+  for (i = 0; i < 8; i++) {
+    for (j = 0; j < 8; j++) t[j] = y[j*ystride + i];
+    glj_islow_idct8(z, t);
+    for (j = 0; j < 8; j++) {
+      w[j*8 + i] = (short)GLJ_ISLOW_SATURATE(GLJ_ISLOW_DESCALE(z[j],
+       GLJ_ISLOW_CONST_BITS - GLJ_ISLOW_PASS1_BITS));
+    }
+  }
+  for (j = 0; j < 8; j++) {
+    for (i = 0; i < 8; i++) t[i] = w[j*8 + i];
+    glj_islow_idct8(z, t);
+    for (i = 0; i < 8; i++) {
+      x[j*xstride + i] = (short)GLJ_ISLOW_SATURATE(GLJ_ISLOW_DESCALE(z[i],
+       GLJ_ISLOW_CONST_BITS + GLJ_ISLOW_PASS1_BITS + 3));
+    }
+  }
+}
+
+/* Only x[0] is written, as every sample of a DC-only block has its value. */
+void glj_islow_idct8x8_dc(short *x, const short *y) {
+  long dc;
+  dc = GLJ_ISLOW_SATURATE(y[0]*(1L << GLJ_ISLOW_PASS1_BITS));
+  x[0] = (short)GLJ_ISLOW_DESCALE(dc, GLJ_ISLOW_PASS1_BITS + 3);
+}
+
+#if defined(GLJ_HAVE_SSE2)
+
+/* With the inputs of each transform interleaved in pairs, _mm_madd_epi16()
+    gives a*y0 + b*y1 in 32 bits, so the odd part is written out as four such
+    dot products of the inputs instead of the shared z1 to z5 of
+    glj_islow_idct8().
+   Integer sums do not depend on their order, which keeps the results the
+    same. */
+#define GLJ_ISLOW_PAIR(a, b) (_mm_set_epi16(b, a, b, a, b, a, b, a))
+
+/* Eight inverse DCTs at once, one in each 16-bit lane of y[0] to y[7]. */
+static void glj_islow_idct8_sse2(__m128i x[8], const __m128i y[8],
+ int shift) {
+  __m128i r[8][2];
+  __m128i round;
+  __m128i count;
+  int h;
+  round = _mm_set1_epi32(1 << (shift - 1));
+  count = _mm_cvtsi32_si128(shift);
+  for (h = 0; h < 2; h++) {
+    __m128i e04;
+    __m128i e26;
+    __m128i o13;
+    __m128i o57;
+    __m128i tmp0;
+    __m128i tmp1;
+    __m128i tmp2;
+    __m128i tmp3;
+    __m128i tmp10;
+    __m128i tmp11;
+    __m128i tmp12;
+    __m128i tmp13;
+    if (h == 0) {
+      e04 = _mm_unpacklo_epi16(y[0], y[4]);
+      e26 = _mm_unpacklo_epi16(y[2], y[6]);
+      o13 = _mm_unpacklo_epi16(y[1], y[3]);
+      o57 = _mm_unpacklo_epi16(y[5], y[7]);
+    }
+    else {
+      e04 = _mm_unpackhi_epi16(y[0], y[4]);
+      e26 = _mm_unpackhi_epi16(y[2], y[6]);
+      o13 = _mm_unpackhi_epi16(y[1], y[3]);
+      o57 = _mm_unpackhi_epi16(y[5], y[7]);
+    }
+    /* Even part, with the rounding of the descale added up front */
+    tmp0 = _mm_add_epi32(_mm_madd_epi16(e04, GLJ_ISLOW_PAIR(8192, 8192)),
+     round);
+    tmp1 = _mm_add_epi32(_mm_madd_epi16(e04, GLJ_ISLOW_PAIR(8192, -8192)),
+     round);
+    tmp3 = _mm_madd_epi16(e26, GLJ_ISLOW_PAIR(10703, 4433));
+    tmp2 = _mm_madd_epi16(e26, GLJ_ISLOW_PAIR(4433, -10704));
+    tmp10 = _mm_add_epi32(tmp0, tmp3);
+    tmp13 = _mm_sub_epi32(tmp0, tmp3);
+    tmp11 = _mm_add_epi32(tmp1, tmp2);
+    tmp12 = _mm_sub_epi32(tmp1, tmp2);
+    /* Odd part */
+    tmp3 = _mm_add_epi32(_mm_madd_epi16(o13, GLJ_ISLOW_PAIR(11363, 9633)),
+     _mm_madd_epi16(o57, GLJ_ISLOW_PAIR(6437, 2260)));
+    tmp2 = _mm_add_epi32(_mm_madd_epi16(o13, GLJ_ISLOW_PAIR(9633, -2259)),
+     _mm_madd_epi16(o57, GLJ_ISLOW_PAIR(-11362, -6436)));
+    tmp1 = _mm_add_epi32(_mm_madd_epi16(o13, GLJ_ISLOW_PAIR(6437, -11362)),
+     _mm_madd_epi16(o57, GLJ_ISLOW_PAIR(2261, 9633)));
+    tmp0 = _mm_add_epi32(_mm_madd_epi16(o13, GLJ_ISLOW_PAIR(2260, -6436)),
+     _mm_madd_epi16(o57, GLJ_ISLOW_PAIR(9633, -11363)));
+    r[0][h] = _mm_sra_epi32(_mm_add_epi32(tmp10, tmp3), count);
+    r[7][h] = _mm_sra_epi32(_mm_sub_epi32(tmp10, tmp3), count);
+    r[1][h] = _mm_sra_epi32(_mm_add_epi32(tmp11, tmp2), count);
+    r[6][h] = _mm_sra_epi32(_mm_sub_epi32(tmp11, tmp2), count);
+    r[2][h] = _mm_sra_epi32(_mm_add_epi32(tmp12, tmp1), count);
+    r[5][h] = _mm_sra_epi32(_mm_sub_epi32(tmp12, tmp1), count);
+    r[3][h] = _mm_sra_epi32(_mm_add_epi32(tmp13, tmp0), count);
+    r[4][h] = _mm_sra_epi32(_mm_sub_epi32(tmp13, tmp0), count);
+  }
+  for (h = 0; h < 8; h++) x[h] = _mm_packs_epi32(r[h][0], r[h][1]);
+}
+
+static void glj_transpose8x8_sse2(__m128i x[8]) {
+  __m128i a[8];
+  __m128i b[8];
+  int i;
+  for (i = 0; i < 4; i++) {
+    a[2*i] = _mm_unpacklo_epi16(x[2*i], x[2*i + 1]);
+    a[2*i + 1] = _mm_unpackhi_epi16(x[2*i], x[2*i + 1]);
+  }
+  for (i = 0; i < 2; i++) {
+    b[4*i] = _mm_unpacklo_epi32(a[4*i], a[4*i + 2]);
+    b[4*i + 1] = _mm_unpackhi_epi32(a[4*i], a[4*i + 2]);
+    b[4*i + 2] = _mm_unpacklo_epi32(a[4*i + 1], a[4*i + 3]);
+    b[4*i + 3] = _mm_unpackhi_epi32(a[4*i + 1], a[4*i + 3]);
+  }
+  for (i = 0; i < 4; i++) {
+    x[2*i] = _mm_unpacklo_epi64(b[i], b[i + 4]);
+    x[2*i + 1] = _mm_unpackhi_epi64(b[i], b[i + 4]);
+  }
+}
+
+void glj_islow_idct8x8_sse2(short *x, int xstride, const short *y,
+ int ystride) {
+  __m128i v[8];
+  int i;
+  for (i = 0; i < 8; i++) {
+    v[i] = _mm_loadu_si128((const __m128i *)(y + i*ystride));
+  }
+  /* The columns are transformed in the lanes of the rows, then the rows in
+     the lanes of the transposed columns */
+  glj_islow_idct8_sse2(v, v, GLJ_ISLOW_CONST_BITS - GLJ_ISLOW_PASS1_BITS);
+  glj_transpose8x8_sse2(v);
+  glj_islow_idct8_sse2(v, v,
+   GLJ_ISLOW_CONST_BITS + GLJ_ISLOW_PASS1_BITS + 3);
+  glj_transpose8x8_sse2(v);
+  for (i = 0; i < 8; i++) {
+    _mm_storeu_si128((__m128i *)(x + i*xstride), v[i]);
+  }
+}
+
+#endif
@@ -16,6 +16,45 @@ See the License for the specific language governing permissions and limitations
 #if !defined(_dct_H)
 # define _dct_H (1)
 
+# if defined(__SSE2__)
+#  define GLJ_HAVE_SSE2 (1)
+# endif
+
 void glj_real_idct8x8(short *x, int xstride, const short *y, int ystride);
+void glj_real_idct4x4(short *x, int xstride, const short *y, int ystride);
+void glj_real_idct2x2(short *x, int xstride, const short *y, int ystride);
+void glj_real_idct1x1(short *x, const short *y);
+void glj_real_idct8x8_dc(short *x, const short *y);
+void glj_real_idct8x8_2x2(short *x, int xstride, const short *y, int ystride);
+void glj_real_idct8x8_4x4(short *x, int xstride, const short *y, int ystride);
+
+/* The number of 8x8 blocks glj_real_idct8x8_store() transforms at once */
+# define GLJ_IDCT_BATCH_MAX (16)
+
+/* Fold the scales that glj_real_idct8x8() applies to its inputs into the
+    quantization table tbl (in natural order), giving the table used by
+    glj_real_idct8x8_store(). */
+void glj_real_idct8x8_prescale(float *scaled, const unsigned short *tbl);
+
+/* Reconstruct up to GLJ_IDCT_BATCH_MAX blocks of quantized coefficients y[k]
+    straight into 8-bit samples at x[k] with a stride of xstride[k], with the
+    dequantization, inverse DCT, level shift and clamp in a single pass.
+   The samples are within one of those of glj_real_idct8x8() of the
+    dequantized coefficients, as the scales are rounded into the table. */
+void glj_real_idct8x8_store(unsigned char *const *x, const int *xstride,
+ const short *const *y, const float *const *scaled, int nblocks);
+
+/* The integer inverse DCT of libjpeg's JDCT_ISLOW, which gives the same
+    samples as libjpeg for every block of a valid stream. */
+void glj_islow_idct8x8(short *x, int xstride, const short *y, int ystride);
+void glj_islow_idct8x8_dc(short *x, const short *y);
+
+# if defined(GLJ_HAVE_SSE2)
+void glj_islow_idct8x8_sse2(short *x, int xstride, const short *y,
+ int ystride);
+#  define GLJ_ISLOW_IDCT8X8 glj_islow_idct8x8_sse2
+# else
+#  define GLJ_ISLOW_IDCT8X8 glj_islow_idct8x8
+# endif
 
 #endif
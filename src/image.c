@@ -21,6 +21,11 @@ See the License for the specific language governing permissions and limitations
 
 #define IMAGE_ALIGN (16)
 
+/* Room for the widest pixels, e.g., rgba, or for rows pstride bytes apart */
+static int image_pixels_size(const image *img) {
+  return GLJ_MAXI(img->pstride, img->width*4)*img->height;
+}
+
 int image_init(image *img, jpeg_header *header) {
   int hmax;
   int vmax;
@@ -32,6 +37,7 @@ int image_init(image *img, jpeg_header *header) {
   img->width = header->width;
   img->height = header->height;
   img->nplanes = header->ncomps;
+  img->scale = header->scale;
   hmax = 0;
   vmax = 0;
   for (i = 0; i < header->ncomps; i++) {
@@ -46,8 +52,8 @@ int image_init(image *img, jpeg_header *header) {
     image_plane *plane;
     comp = &header->comp[i];
     plane = &img->plane[i];
-    plane->width = comp->hblocks << 3;
-    plane->height = comp->vblocks << 3;
+    plane->width = comp->hblocks << (3 - header->scale);
+    plane->height = comp->vblocks << (3 - header->scale);
     /* TODO support 16-bit images */
     plane->xstride = 1;
     plane->ystride = plane->xstride*plane->width;
@@ -68,7 +74,7 @@ int image_init(image *img, jpeg_header *header) {
     plane->cstride = (comp->vblocks + ((1 << plane->xdec) - 1)) >> plane->xdec;
     blocks += (comp->hblocks << plane->xdec)*plane->cstride;
   }
-  img->pixels = glj_aligned_malloc(img->width*img->height*3, IMAGE_ALIGN);
+  img->pixels = glj_aligned_malloc(image_pixels_size(img), IMAGE_ALIGN);
   if (img->pixels == NULL) {
     image_clear(img);
     return EXIT_FAILURE;
@@ -89,13 +95,36 @@ int image_init(image *img, jpeg_header *header) {
     comp = &header->comp[i];
     plane = &img->plane[i];
     plane->coef = coef;
-    coef += (plane->width << (plane->xdec + 3))*plane->cstride;
+    coef += (comp->hblocks << (plane->xdec + 6))*plane->cstride;
     plane->index = index;
     index += (comp->hblocks << plane->xdec)*plane->cstride;
   }
   return EXIT_SUCCESS;
 }
 
+int image_set_pstride(image *img, int pstride) {
+  unsigned char *pixels;
+  int old;
+  int size;
+  if (pstride < 0) {
+    return EXIT_FAILURE;
+  }
+  old = img->pstride;
+  size = image_pixels_size(img);
+  img->pstride = pstride;
+  if (image_pixels_size(img) == size) {
+    return EXIT_SUCCESS;
+  }
+  pixels = glj_aligned_malloc(image_pixels_size(img), IMAGE_ALIGN);
+  if (pixels == NULL) {
+    img->pstride = old;
+    return EXIT_FAILURE;
+  }
+  glj_aligned_free(img->pixels);
+  img->pixels = pixels;
+  return EXIT_SUCCESS;
+}
+
 void image_zero(image *img) {
   int i;
   int blocks;
@@ -104,9 +133,10 @@ void image_zero(image *img) {
     image_plane *plane;
     plane = &img->plane[i];
     memset(plane->data, 0, plane->ystride*plane->height);
-    blocks += ((plane->width >> 3) << plane->xdec)*plane->cstride;
+    blocks += ((plane->width >> (3 - img->scale)) << plane->xdec)*
+     plane->cstride;
   }
-  memset(img->pixels, 0, img->width*img->height*3);
+  memset(img->pixels, 0, image_pixels_size(img));
   memset(img->coef, 0, blocks*64*sizeof(short));
   memset(img->index, 0, blocks*sizeof(int));
 }
@@ -48,9 +48,19 @@ struct image {
   int packed;
   int *index;
   unsigned char *pixels;
+  /* The distance in bytes between rows of pixels, or 0 for rows packed at
+      the width of the output, set with image_set_pstride() */
+  int pstride;
+  /* The log2 of the factor the samples in the planes and pixels are scaled
+      down by, the coefficients are always full size */
+  int scale;
 };
 
 int image_init(image *img, jpeg_header *header);
+/* Place the rows of pixels pstride bytes apart, reallocating the pixels to
+    fit them, or packed at the width of the output when pstride is 0.
+   The stride must hold a row of the pixels decoded to img. */
+int image_set_pstride(image *img, int pstride);
 void image_zero(image *img);
 void image_clear(image *img);
 
@@ -0,0 +1,416 @@
+/* JPEG GPU project
+Copyright (c) 2014-2016 JPEG GPU project contributors.  All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ use this file except in compliance with the License.
+You may obtain a copy of the License at:
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed
+ under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+ CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and limitations
+ under the License. */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <getopt.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "jpeg_wrap.h"
+#include "xjpeg.h"
+#include "thread.h"
+#include "logging.h"
+
+#define NAME "jpeg_batch"
+
+#define BATCH_PATH_MAX (4096)
+
+typedef struct batch_file_list batch_file_list;
+
+struct batch_file_list {
+  char **name;
+  int nfiles;
+  int nfiles_max;
+};
+
+typedef struct batch_result batch_result;
+
+struct batch_result {
+  /* The time in seconds from opening the file to the decoded image */
+  double time;
+  /* The number of pixels in the image, or 0 if it failed to decode */
+  double pixels;
+};
+
+typedef struct batch_ctx batch_ctx;
+
+struct batch_ctx {
+  jpeg_decode_ctx_vtbl vtbl;
+  jpeg_decode_out out;
+  /* The name of the inverse DCT of xjpeg */
+  const char *idct;
+  const batch_file_list *files;
+  batch_result *result;
+};
+
+static double batch_time(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec*1e-9;
+}
+
+static int batch_add_file(batch_file_list *files, const char *name) {
+  char *copy;
+  if (files->nfiles == files->nfiles_max) {
+    char **name;
+    int nfiles_max;
+    nfiles_max = files->nfiles_max ? 2*files->nfiles_max : 256;
+    name = (char **)realloc(files->name, nfiles_max*sizeof(char *));
+    if (name == NULL) {
+      return EXIT_FAILURE;
+    }
+    files->name = name;
+    files->nfiles_max = nfiles_max;
+  }
+  copy = (char *)malloc(strlen(name) + 1);
+  if (copy == NULL) {
+    return EXIT_FAILURE;
+  }
+  strcpy(copy, name);
+  files->name[files->nfiles++] = copy;
+  return EXIT_SUCCESS;
+}
+
+static void batch_clear_files(batch_file_list *files) {
+  int i;
+  for (i = 0; i < files->nfiles; i++) {
+    free(files->name[i]);
+  }
+  free(files->name);
+  memset(files, 0, sizeof(batch_file_list));
+}
+
+/* Does name end in .jpg or .jpeg, ignoring case */
+static int batch_is_jpeg(const char *name) {
+  const char *ext;
+  char lower[6];
+  int i;
+  ext = strrchr(name, '.');
+  if (ext == NULL || strlen(ext) >= sizeof(lower)) {
+    return 0;
+  }
+  for (i = 0; ext[i] != '\0'; i++) {
+    lower[i] = tolower((unsigned char)ext[i]);
+  }
+  lower[i] = '\0';
+  return strcmp(lower, ".jpg") == 0 || strcmp(lower, ".jpeg") == 0;
+}
+
+/* Add every .jpg or .jpeg file in the directory dir, in the order they are
+    listed. */
+static int batch_add_dir(batch_file_list *files, const char *dir) {
+  DIR *dp;
+  struct dirent *de;
+  char name[BATCH_PATH_MAX];
+  dp = opendir(dir);
+  if (dp == NULL) {
+    fprintf(stderr, "Error, could not open directory %s\n", dir);
+    return EXIT_FAILURE;
+  }
+  while ((de = readdir(dp)) != NULL) {
+    struct stat st;
+    if (!batch_is_jpeg(de->d_name) ||
+     strlen(dir) + strlen(de->d_name) + 2 > sizeof(name)) {
+      continue;
+    }
+    strcpy(name, dir);
+    strcat(name, "/");
+    strcat(name, de->d_name);
+    if (stat(name, &st) != 0 || !S_ISREG(st.st_mode)) {
+      continue;
+    }
+    if (batch_add_file(files, name) != EXIT_SUCCESS) {
+      closedir(dp);
+      return EXIT_FAILURE;
+    }
+  }
+  closedir(dp);
+  return EXIT_SUCCESS;
+}
+
+/* Add a file, or the jpeg files in it if it is a directory. */
+static int batch_add_path(batch_file_list *files, const char *path) {
+  struct stat st;
+  if (stat(path, &st) == 0 && S_ISDIR(st.st_mode)) {
+    return batch_add_dir(files, path);
+  }
+  return batch_add_file(files, path);
+}
+
+/* Add the files or directories named one per line in the file list, or read
+    from stdin if list is "-". */
+static int batch_add_list(batch_file_list *files, const char *list) {
+  FILE *fp;
+  char line[BATCH_PATH_MAX];
+  int ret;
+  fp = strcmp(list, "-") == 0 ? stdin : fopen(list, "r");
+  if (fp == NULL) {
+    fprintf(stderr, "Error, could not open file list %s\n", list);
+    return EXIT_FAILURE;
+  }
+  ret = EXIT_SUCCESS;
+  while (ret == EXIT_SUCCESS && fgets(line, sizeof(line), fp) != NULL) {
+    size_t len;
+    len = strlen(line);
+    while (len > 0 && (line[len - 1] == '\n' || line[len - 1] == '\r')) {
+      line[--len] = '\0';
+    }
+    if (len > 0) {
+      ret = batch_add_path(files, line);
+    }
+  }
+  if (fp != stdin) {
+    fclose(fp);
+  }
+  return ret;
+}
+
+/* Load and decode one file with a decoder of its own, as a server would for
+    every request. */
+static void batch_decode(void *ctx, int thread, int task) {
+  batch_ctx *batch;
+  batch_result *result;
+  jpeg_info info;
+  double start;
+  (void)thread;
+  batch = (batch_ctx *)ctx;
+  result = &batch->result[task];
+  result->pixels = 0;
+  start = batch_time();
+  memset(&info, 0, sizeof(jpeg_info));
+  if (jpeg_info_init(&info, batch->files->name[task%batch->files->nfiles]) ==
+   EXIT_SUCCESS) {
+    jpeg_decode_ctx *dec;
+    dec = (*batch->vtbl.decode_alloc)(&info);
+    if (dec != NULL) {
+      jpeg_header header;
+      image img;
+      /* The images are already decoded in parallel, one per thread */
+      if (batch->vtbl.decode_alloc == XJPEG_DECODE_CTX_VTBL.decode_alloc) {
+        xjpeg_use_threads((struct xjpeg_decode_ctx *)dec, 1);
+        xjpeg_use_idct((struct xjpeg_decode_ctx *)dec, batch->idct);
+      }
+      if ((*batch->vtbl.decode_header)(dec, &header) == EXIT_SUCCESS &&
+       image_init(&img, &header) == EXIT_SUCCESS) {
+        if ((*batch->vtbl.decode_image)(dec, &img, batch->out, NULL) ==
+         EXIT_SUCCESS) {
+          result->pixels = (double)header.width*header.height;
+        }
+        image_clear(&img);
+      }
+      (*batch->vtbl.decode_free)(dec);
+    }
+    jpeg_info_clear(&info);
+  }
+  result->time = batch_time() - start;
+}
+
+static int batch_compare_time(const void *a, const void *b) {
+  double ta;
+  double tb;
+  ta = ((const batch_result *)a)->time;
+  tb = ((const batch_result *)b)->time;
+  return ta < tb ? -1 : ta > tb;
+}
+
+/* The nearest rank p-th percentile of n results sorted by time */
+static double batch_percentile(const batch_result *result, int n, int p) {
+  int k;
+  k = (p*n + 99)/100 - 1;
+  return result[k < 0 ? 0 : k].time;
+}
+
+static const char *OPTSTRING = "hi:o:I:t:r:l:";
+
+static const struct option OPTIONS[] = {
+  { "help", no_argument, NULL, 'h' },
+  { "impl", required_argument, NULL, 'i' },
+  { "out", required_argument, NULL, 'o' },
+  { "idct", required_argument, NULL, 'I' },
+  { "threads", required_argument, NULL, 't' },
+  { "repeat", required_argument, NULL, 'r' },
+  { "list", required_argument, NULL, 'l' },
+  { NULL, 0, NULL, 0 }
+};
+
+static void usage() {
+  fprintf(stderr,
+   "Usage: %s [options] [jpeg_file | directory]...\n\n"
+   "Decode every jpeg file on the CPU, one per worker thread, and report the\n"
+   " throughput and latency.\n\n"
+   "Options:\n\n"
+   "  -h --help                      Display this help and exit.\n"
+   "  -i --impl <decoder>            Software decoder to use.\n"
+   "                                 libjpeg (default) => platform libjpeg\n"
+   "                                 xjpeg => project decoder\n"
+   "  -o --out <format>              Format the decoder should output.\n"
+   "                                 pack, quant, dct, yuv (default), rgb,\n"
+   "                                  rgba or bgra\n"
+   "  -I --idct <name>               Inverse DCT of xjpeg yuv and rgb output,\n"
+   "                                  float (default) or islow.\n"
+   "  -t --threads <n>               Number of worker threads, by default one\n"
+   "                                  per CPU.\n"
+   "  -r --repeat <n>                Decode every file n times.\n"
+   "  -l --list <file>               Also decode the files or directories\n"
+   "                                  listed one per line in this file, or\n"
+   "                                  stdin if it is -.\n\n"
+   " Directories are searched for .jpg and .jpeg files, not recursively.\n\n",
+   NAME);
+}
+
+int main(int argc, char *argv[]) {
+  batch_file_list files;
+  batch_ctx batch;
+  int nthreads;
+  int repeat;
+  int ntasks;
+  int failed;
+  double pixels;
+  double start;
+  double time;
+  int i;
+  glj_log_init(NULL);
+  memset(&files, 0, sizeof(batch_file_list));
+  batch.vtbl = LIBJPEG_DECODE_CTX_VTBL;
+  batch.out = JPEG_DECODE_YUV;
+  batch.idct = XJPEG_IDCT_NAMES[XJPEG_IDCT_FLOAT];
+  nthreads = glj_thread_count();
+  repeat = 1;
+  {
+    int c;
+    int loi;
+    while ((c = getopt_long(argc, argv, OPTSTRING, OPTIONS, &loi)) != EOF) {
+      switch (c) {
+        case 'i' : {
+          if (strcmp("libjpeg", optarg) == 0) {
+            batch.vtbl = LIBJPEG_DECODE_CTX_VTBL;
+          }
+          else if (strcmp("xjpeg", optarg) == 0) {
+            batch.vtbl = XJPEG_DECODE_CTX_VTBL;
+          }
+          else {
+            fprintf(stderr, "Invalid decoder implementation: %s\n", optarg);
+            usage();
+            return EXIT_FAILURE;
+          }
+          break;
+        }
+        case 'o' : {
+          for (i = 0; i < JPEG_DECODE_OUT_MAX; i++) {
+            if (strcmp(JPEG_DECODE_OUT_NAMES[i], optarg) == 0) {
+              break;
+            }
+          }
+          if (i == JPEG_DECODE_OUT_MAX) {
+            fprintf(stderr, "Invalid decoder output format: %s\n", optarg);
+            usage();
+            return EXIT_FAILURE;
+          }
+          batch.out = (jpeg_decode_out)i;
+          break;
+        }
+        case 'I' : {
+          for (i = 0; i < XJPEG_IDCT_MAX; i++) {
+            if (strcmp(XJPEG_IDCT_NAMES[i], optarg) == 0) {
+              break;
+            }
+          }
+          if (i == XJPEG_IDCT_MAX) {
+            fprintf(stderr, "Invalid inverse DCT: %s\n", optarg);
+            usage();
+            return EXIT_FAILURE;
+          }
+          batch.idct = XJPEG_IDCT_NAMES[i];
+          break;
+        }
+        case 't' : {
+          nthreads = atoi(optarg);
+          if (nthreads < 1) {
+            fprintf(stderr, "Invalid number of threads: %s\n", optarg);
+            usage();
+            return EXIT_FAILURE;
+          }
+          break;
+        }
+        case 'r' : {
+          repeat = atoi(optarg);
+          if (repeat < 1) {
+            fprintf(stderr, "Invalid repeat count: %s\n", optarg);
+            usage();
+            return EXIT_FAILURE;
+          }
+          break;
+        }
+        case 'l' : {
+          if (batch_add_list(&files, optarg) != EXIT_SUCCESS) {
+            return EXIT_FAILURE;
+          }
+          break;
+        }
+        case 'h' :
+        default : {
+          usage();
+          return EXIT_FAILURE;
+        }
+      }
+    }
+    for (; optind < argc; optind++) {
+      if (batch_add_path(&files, argv[optind]) != EXIT_SUCCESS) {
+        return EXIT_FAILURE;
+      }
+    }
+  }
+  if (files.nfiles == 0) {
+    usage();
+    return EXIT_FAILURE;
+  }
+  ntasks = files.nfiles*repeat;
+  batch.files = &files;
+  batch.result = (batch_result *)malloc(ntasks*sizeof(batch_result));
+  if (batch.result == NULL) {
+    fprintf(stderr, "Error, could not allocate %i results\n", ntasks);
+    return EXIT_FAILURE;
+  }
+  start = batch_time();
+  glj_run_tasks(batch_decode, &batch, ntasks, nthreads);
+  time = batch_time() - start;
+  failed = 0;
+  pixels = 0;
+  for (i = 0; i < ntasks; i++) {
+    if (batch.result[i].pixels == 0) {
+      if (i < files.nfiles) {
+        fprintf(stderr, "Error decoding %s\n", files.name[i]);
+      }
+      failed++;
+    }
+    pixels += batch.result[i].pixels;
+  }
+  qsort(batch.result, ntasks, sizeof(batch_result), batch_compare_time);
+  printf("Decoded %i of %i images on %i threads in %.3f s\n",
+   ntasks - failed, ntasks, nthreads, time);
+  printf("Images/s : %.1f\n", (ntasks - failed)/time);
+  printf("MPix/s   : %.1f\n", pixels/time*1e-6);
+  printf("Latency  : p50 %.3f ms, p99 %.3f ms\n",
+   batch_percentile(batch.result, ntasks, 50)*1e3,
+   batch_percentile(batch.result, ntasks, 99)*1e3);
+  free(batch.result);
+  batch_clear_files(&files);
+  return failed ? EXIT_FAILURE : EXIT_SUCCESS;
+}
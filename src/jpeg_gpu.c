@@ -470,7 +470,7 @@ static GLint create_tex_rect(GLuint *vao, GLuint *vbo, GLuint prog, int width,
   return GL_TRUE;
 }
 
-static const char *OPTSTRING = "hi:o:dH";
+static const char *OPTSTRING = "hi:o:c:s:x:I:dH";
 
 static const struct option OPTIONS[] = {
   { "help", no_argument, NULL, 'h' },
@@ -478,6 +478,10 @@ static const struct option OPTIONS[] = {
   { "no-gpu", no_argument, NULL, 0 },
   { "impl", required_argument, NULL, 'i' },
   { "out", required_argument, NULL, 'o' },
+  { "crop", required_argument, NULL, 'c' },
+  { "scale", required_argument, NULL, 's' },
+  { "index", required_argument, NULL, 'x' },
+  { "idct", required_argument, NULL, 'I' },
   { "dump", no_argument, NULL, 'd' },
   { "header", no_argument, NULL, 'H' },
   { NULL, 0, NULL, 0 }
@@ -500,6 +504,17 @@ static void usage() {
    "                                 dct => DCT (12-bit dequantized)\n"
    "                                 yuv (default) => YUV (4:4:4 or 4:2:0)\n"
    "                                 rgb => RGB (4:4:4)\n"
+   "  -c --crop <w>x<h>+<x>+<y>      Decode only this region of the image,\n"
+   "                                 expanded to whole MCUs.\n"
+   "  -s --scale <n>                 Scale the image down by 2^n, 0 to 3,\n"
+   "                                 with yuv or rgb output.\n"
+   "  -x --index <file>              Decode the scan from the MCU index in\n"
+   "                                  this file, built and saved there when\n"
+   "                                  missing (xjpeg only).\n"
+   "  -I --idct <name>               Inverse DCT of full scale yuv output\n"
+   "                                  (xjpeg only).\n"
+   "                                 float (default) => same as the GPU\n"
+   "                                 islow => same as libjpeg\n"
    "  -d --dump                      Dump jpeg data in the output format.\n"
    "  -H --header                    Print the jpeg header.\n\n"
    " %s accepts only 8-bit non-hierarchical JPEG files.\n\n", NAME, NAME);
@@ -512,6 +527,11 @@ int main(int argc, char *argv[]) {
   int no_gpu;
   int dump;
   int head;
+  jpeg_crop crop;
+  jpeg_crop *cropped;
+  int scale;
+  const char *index_name;
+  const char *idct_name;
   jpeg_info info;
   jpeg_header header;
   image img;
@@ -519,6 +539,10 @@ int main(int argc, char *argv[]) {
   no_gpu = 0;
   dump = 0;
   head = 0;
+  cropped = NULL;
+  scale = 0;
+  index_name = NULL;
+  idct_name = NULL;
   glj_log_init(NULL);
   vtbl = LIBJPEG_DECODE_CTX_VTBL;
   out = JPEG_DECODE_YUV;
@@ -579,6 +603,28 @@ int main(int argc, char *argv[]) {
           }
           break;
         }
+        case 'c' : {
+          if (sscanf(optarg, "%dx%d+%d+%d", &crop.width, &crop.height,
+           &crop.x, &crop.y) != 4) {
+            fprintf(stderr, "Invalid crop region: %s\n", optarg);
+            usage();
+            return EXIT_FAILURE;
+          }
+          cropped = &crop;
+          break;
+        }
+        case 's' : {
+          scale = atoi(optarg);
+          break;
+        }
+        case 'x' : {
+          index_name = optarg;
+          break;
+        }
+        case 'I' : {
+          idct_name = optarg;
+          break;
+        }
         case 'd' : {
           dump = 1;
           break;
@@ -604,12 +650,34 @@ int main(int argc, char *argv[]) {
     usage();
     return EXIT_FAILURE;
   }
+  if (scale != 0 && out != JPEG_DECODE_YUV && out != JPEG_DECODE_RGB) {
+    fprintf(stderr, "Only yuv and rgb output can be scaled\n");
+    return EXIT_FAILURE;
+  }
+  if (index_name != NULL &&
+   vtbl.decode_alloc != XJPEG_DECODE_CTX_VTBL.decode_alloc) {
+    fprintf(stderr, "Only the xjpeg decoder can use an index\n");
+    return EXIT_FAILURE;
+  }
+  if (idct_name != NULL &&
+   vtbl.decode_alloc != XJPEG_DECODE_CTX_VTBL.decode_alloc) {
+    fprintf(stderr, "Only the xjpeg decoder can select the inverse DCT\n");
+    return EXIT_FAILURE;
+  }
 
   /* Decompress the jpeg header and allocate memory for the image planes.
      We will directly decode into these buffers and upload them to the GPU. */
   {
     jpeg_decode_ctx *dec;
     dec = (*vtbl.decode_alloc)(&info);
+    if (index_name != NULL && xjpeg_use_index((struct xjpeg_decode_ctx *)dec,
+     &info, index_name) != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+    if (idct_name != NULL && xjpeg_use_idct((struct xjpeg_decode_ctx *)dec,
+     idct_name) != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
     (*vtbl.decode_header)(dec, &header);
     if (head) {
       int i, j;
@@ -634,13 +702,19 @@ int main(int argc, char *argv[]) {
       }
       return EXIT_SUCCESS;
     }
+    if (cropped != NULL && jpeg_header_crop(&header, cropped) != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+    if (jpeg_header_scale(&header, scale) != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
     if (image_init(&img, &header) != EXIT_SUCCESS) {
       fprintf(stderr, "Error initializing image\n");
       return EXIT_FAILURE;
     }
     if (dump) {
       int i, j, k;
-      (*vtbl.decode_image)(dec, &img, out);
+      (*vtbl.decode_image)(dec, &img, out, cropped);
       if (out == JPEG_DECODE_PACK) {
         img.packed = 0;
         for (i = 0; i < img.nplanes; i++) {
@@ -698,7 +772,7 @@ int main(int argc, char *argv[]) {
       }
       return EXIT_SUCCESS;
     }
-    if ((*vtbl.decode_image)(dec, &img, out) != EXIT_SUCCESS) {
+    if ((*vtbl.decode_image)(dec, &img, out, cropped) != EXIT_SUCCESS) {
       return EXIT_FAILURE;
     }
     (*vtbl.decode_free)(dec);
@@ -1213,6 +1287,14 @@ int main(int argc, char *argv[]) {
     }
 
     dec = (*vtbl.decode_alloc)(&info);
+    if (index_name != NULL && xjpeg_use_index((struct xjpeg_decode_ctx *)dec,
+     &info, index_name) != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
+    if (idct_name != NULL && xjpeg_use_idct((struct xjpeg_decode_ctx *)dec,
+     idct_name) != EXIT_SUCCESS) {
+      return EXIT_FAILURE;
+    }
 
     time = last = glfwGetTime();
     cpu = 0;
@@ -1231,7 +1313,11 @@ int main(int argc, char *argv[]) {
       if (!no_cpu) {
         (*vtbl.decode_reset)(dec, &info);
         (*vtbl.decode_header)(dec, &header);
-        if ((*vtbl.decode_image)(dec, &img, out) != EXIT_SUCCESS) {
+        if (cropped != NULL) {
+          jpeg_header_crop(&header, cropped);
+        }
+        jpeg_header_scale(&header, scale);
+        if ((*vtbl.decode_image)(dec, &img, out, cropped) != EXIT_SUCCESS) {
          break;
         }
       }
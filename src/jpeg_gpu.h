@@ -0,0 +1,1602 @@
+/* Generated file, do not commit */
+static const char GREY_FS[] = {
+  0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34, 0x30,
+  0x0a, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x65, 0x78,
+  0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x6f, 0x75, 0x74, 0x20,
+  0x76, 0x65, 0x63, 0x33, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3b, 0x0a,
+  0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d,
+  0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x67, 0x72, 0x65, 0x79, 0x5f,
+  0x74, 0x65, 0x78, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61,
+  0x69, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x73, 0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63,
+  0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x74, 0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78,
+  0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x74, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x79, 0x3d, 0x66, 0x6c, 0x6f,
+  0x61, 0x74, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63,
+  0x68, 0x28, 0x67, 0x72, 0x65, 0x79, 0x5f, 0x74, 0x65, 0x78, 0x2c, 0x69,
+  0x76, 0x65, 0x63, 0x32, 0x28, 0x73, 0x2c, 0x74, 0x29, 0x2c, 0x30, 0x29,
+  0x2e, 0x72, 0x29, 0x2f, 0x32, 0x35, 0x35, 0x2e, 0x30, 0x3b, 0x0a, 0x20,
+  0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x76, 0x65, 0x63, 0x33, 0x28,
+  0x79, 0x2c, 0x79, 0x2c, 0x79, 0x29, 0x3b, 0x0a, 0x7d, 0x0a
+, 0x00 };
+static const char HORZ_FS[] = {
+  0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34, 0x30,
+  0x0a, 0x0a, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x47, 0x4c, 0x4a, 0x5f,
+  0x52, 0x45, 0x41, 0x4c, 0x5f, 0x49, 0x44, 0x43, 0x54, 0x38, 0x58, 0x38,
+  0x5f, 0x53, 0x43, 0x41, 0x4c, 0x45, 0x53, 0x5b, 0x38, 0x2a, 0x38, 0x5d,
+  0x20, 0x3d, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x5b, 0x5d, 0x28, 0x0a,
+  0x20, 0x20, 0x30, 0x2e, 0x31, 0x32, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x2c, 0x20, 0x20, 0x30, 0x2e, 0x31, 0x37, 0x33, 0x33, 0x37, 0x39, 0x39,
+  0x38, 0x30, 0x36, 0x36, 0x35, 0x32, 0x36, 0x38, 0x34, 0x33, 0x32, 0x37,
+  0x32, 0x37, 0x37, 0x30, 0x32, 0x33, 0x39, 0x38, 0x39, 0x34, 0x35, 0x38,
+  0x30, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x31, 0x36, 0x33, 0x33, 0x32,
+  0x30, 0x33, 0x37, 0x30, 0x36, 0x30, 0x39, 0x35, 0x34, 0x37, 0x30, 0x36,
+  0x35, 0x39, 0x38, 0x32, 0x30, 0x38, 0x30, 0x33, 0x39, 0x36, 0x36, 0x37,
+  0x38, 0x34, 0x30, 0x2c, 0x20, 0x20, 0x30, 0x2e, 0x31, 0x34, 0x36, 0x39,
+  0x38, 0x34, 0x34, 0x35, 0x30, 0x33, 0x30, 0x32, 0x34, 0x31, 0x39, 0x38,
+  0x33, 0x39, 0x36, 0x32, 0x31, 0x38, 0x30, 0x38, 0x33, 0x38, 0x38, 0x30,
+  0x37, 0x36, 0x34, 0x31, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x31, 0x32,
+  0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x20, 0x20, 0x30, 0x2e, 0x30,
+  0x39, 0x38, 0x32, 0x31, 0x31, 0x38, 0x36, 0x39, 0x37, 0x39, 0x38, 0x33,
+  0x38, 0x37, 0x37, 0x37, 0x32, 0x36, 0x35, 0x39, 0x37, 0x33, 0x37, 0x31,
+  0x37, 0x30, 0x39, 0x35, 0x37, 0x31, 0x35, 0x32, 0x2c, 0x0a, 0x20, 0x20,
+  0x30, 0x2e, 0x30, 0x36, 0x37, 0x36, 0x34, 0x39, 0x35, 0x31, 0x32, 0x35,
+  0x31, 0x38, 0x32, 0x37, 0x34, 0x36, 0x32, 0x33, 0x30, 0x34, 0x39, 0x39,
+  0x36, 0x35, 0x34, 0x30, 0x30, 0x36, 0x37, 0x30, 0x37, 0x39, 0x39, 0x2c,
+  0x20, 0x30, 0x2e, 0x30, 0x33, 0x34, 0x34, 0x38, 0x37, 0x34, 0x32, 0x32,
+  0x34, 0x31, 0x30, 0x33, 0x36, 0x37, 0x38, 0x37, 0x36, 0x35, 0x34, 0x31,
+  0x39, 0x39, 0x34, 0x36, 0x39, 0x35, 0x34, 0x35, 0x38, 0x36, 0x37, 0x32,
+  0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x31, 0x37, 0x33, 0x33, 0x37, 0x39,
+  0x39, 0x38, 0x30, 0x36, 0x36, 0x35, 0x32, 0x36, 0x38, 0x34, 0x33, 0x32,
+  0x37, 0x32, 0x37, 0x37, 0x30, 0x32, 0x33, 0x39, 0x38, 0x39, 0x34, 0x35,
+  0x38, 0x30, 0x2c, 0x20, 0x20, 0x30, 0x2e, 0x32, 0x34, 0x30, 0x34, 0x38,
+  0x34, 0x39, 0x34, 0x31, 0x35, 0x36, 0x33, 0x39, 0x31, 0x30, 0x38, 0x34,
+  0x34, 0x35, 0x31, 0x36, 0x30, 0x32, 0x32, 0x38, 0x39, 0x38, 0x36, 0x37,
+  0x34, 0x36, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x32, 0x32, 0x36,
+  0x35, 0x33, 0x31, 0x38, 0x36, 0x31, 0x35, 0x38, 0x38, 0x32, 0x32, 0x31,
+  0x39, 0x36, 0x30, 0x37, 0x37, 0x35, 0x36, 0x32, 0x31, 0x33, 0x32, 0x36,
+  0x37, 0x31, 0x39, 0x30, 0x32, 0x2c, 0x20, 0x20, 0x30, 0x2e, 0x32, 0x30,
+  0x33, 0x38, 0x37, 0x33, 0x32, 0x38, 0x39, 0x32, 0x31, 0x32, 0x32, 0x32,
+  0x39, 0x32, 0x38, 0x35, 0x30, 0x36, 0x36, 0x31, 0x32, 0x38, 0x34, 0x34,
+  0x33, 0x39, 0x33, 0x37, 0x37, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e,
+  0x31, 0x37, 0x33, 0x33, 0x37, 0x39, 0x39, 0x38, 0x30, 0x36, 0x36, 0x35,
+  0x32, 0x36, 0x38, 0x34, 0x33, 0x32, 0x37, 0x32, 0x37, 0x37, 0x30, 0x32,
+  0x33, 0x39, 0x38, 0x39, 0x34, 0x35, 0x38, 0x30, 0x2c, 0x20, 0x20, 0x30,
+  0x2e, 0x31, 0x33, 0x36, 0x32, 0x32, 0x33, 0x37, 0x37, 0x36, 0x36, 0x39,
+  0x33, 0x39, 0x35, 0x34, 0x36, 0x36, 0x32, 0x30, 0x31, 0x36, 0x31, 0x36,
+  0x33, 0x30, 0x34, 0x33, 0x32, 0x36, 0x36, 0x39, 0x31, 0x2c, 0x0a, 0x20,
+  0x20, 0x30, 0x2e, 0x30, 0x39, 0x33, 0x38, 0x33, 0x32, 0x35, 0x36, 0x39,
+  0x33, 0x37, 0x39, 0x34, 0x36, 0x36, 0x33, 0x31, 0x31, 0x35, 0x37, 0x33,
+  0x38, 0x38, 0x39, 0x34, 0x36, 0x30, 0x33, 0x30, 0x33, 0x31, 0x39, 0x34,
+  0x2c, 0x20, 0x30, 0x2e, 0x30, 0x34, 0x37, 0x38, 0x33, 0x35, 0x34, 0x32,
+  0x39, 0x30, 0x34, 0x35, 0x36, 0x33, 0x36, 0x32, 0x32, 0x31, 0x34, 0x36,
+  0x36, 0x30, 0x35, 0x37, 0x34, 0x39, 0x38, 0x30, 0x30, 0x33, 0x38, 0x30,
+  0x30, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x31, 0x36, 0x33, 0x33, 0x32,
+  0x30, 0x33, 0x37, 0x30, 0x36, 0x30, 0x39, 0x35, 0x34, 0x37, 0x30, 0x36,
+  0x35, 0x39, 0x38, 0x32, 0x30, 0x38, 0x30, 0x33, 0x39, 0x36, 0x36, 0x37,
+  0x38, 0x34, 0x30, 0x2c, 0x20, 0x20, 0x30, 0x2e, 0x32, 0x32, 0x36, 0x35,
+  0x33, 0x31, 0x38, 0x36, 0x31, 0x35, 0x38, 0x38, 0x32, 0x32, 0x31, 0x39,
+  0x36, 0x30, 0x37, 0x37, 0x35, 0x36, 0x32, 0x31, 0x33, 0x32, 0x36, 0x37,
+  0x31, 0x39, 0x30, 0x32, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x32, 0x31,
+  0x33, 0x33, 0x38, 0x38, 0x33, 0x34, 0x37, 0x36, 0x34, 0x38, 0x33, 0x31,
+  0x38, 0x34, 0x34, 0x30, 0x35, 0x35, 0x30, 0x31, 0x30, 0x35, 0x35, 0x34,
+  0x35, 0x32, 0x36, 0x33, 0x31, 0x31, 0x2c, 0x20, 0x20, 0x30, 0x2e, 0x31,
+  0x39, 0x32, 0x30, 0x34, 0x34, 0x34, 0x33, 0x39, 0x31, 0x37, 0x37, 0x38,
+  0x35, 0x34, 0x30, 0x38, 0x34, 0x32, 0x33, 0x33, 0x36, 0x32, 0x36, 0x36,
+  0x33, 0x31, 0x32, 0x36, 0x30, 0x33, 0x35, 0x2c, 0x0a, 0x20, 0x20, 0x30,
+  0x2e, 0x31, 0x36, 0x33, 0x33, 0x32, 0x30, 0x33, 0x37, 0x30, 0x36, 0x30,
+  0x39, 0x35, 0x34, 0x37, 0x30, 0x36, 0x35, 0x39, 0x38, 0x32, 0x30, 0x38,
+  0x30, 0x33, 0x39, 0x36, 0x36, 0x37, 0x38, 0x34, 0x30, 0x2c, 0x20, 0x20,
+  0x30, 0x2e, 0x31, 0x32, 0x38, 0x33, 0x31, 0x39, 0x39, 0x39, 0x31, 0x37,
+  0x38, 0x39, 0x38, 0x33, 0x34, 0x31, 0x38, 0x38, 0x31, 0x31, 0x35, 0x38,
+  0x38, 0x34, 0x31, 0x35, 0x35, 0x37, 0x36, 0x31, 0x38, 0x37, 0x2c, 0x0a,
+  0x20, 0x20, 0x30, 0x2e, 0x30, 0x38, 0x38, 0x33, 0x38, 0x38, 0x33, 0x34,
+  0x37, 0x36, 0x34, 0x38, 0x33, 0x31, 0x38, 0x34, 0x34, 0x30, 0x35, 0x35,
+  0x30, 0x31, 0x30, 0x35, 0x35, 0x34, 0x35, 0x32, 0x36, 0x33, 0x31, 0x30,
+  0x36, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x34, 0x35, 0x30, 0x35, 0x39, 0x39,
+  0x38, 0x38, 0x38, 0x37, 0x35, 0x34, 0x33, 0x34, 0x32, 0x34, 0x34, 0x36,
+  0x31, 0x31, 0x38, 0x31, 0x38, 0x32, 0x34, 0x33, 0x31, 0x38, 0x33, 0x39,
+  0x33, 0x39, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x31, 0x34, 0x36, 0x39,
+  0x38, 0x34, 0x34, 0x35, 0x30, 0x33, 0x30, 0x32, 0x34, 0x31, 0x39, 0x38,
+  0x33, 0x39, 0x36, 0x32, 0x31, 0x38, 0x30, 0x38, 0x33, 0x38, 0x38, 0x30,
+  0x37, 0x36, 0x34, 0x31, 0x2c, 0x20, 0x20, 0x30, 0x2e, 0x32, 0x30, 0x33,
+  0x38, 0x37, 0x33, 0x32, 0x38, 0x39, 0x32, 0x31, 0x32, 0x32, 0x32, 0x39,
+  0x32, 0x38, 0x35, 0x30, 0x36, 0x36, 0x31, 0x32, 0x38, 0x34, 0x34, 0x33,
+  0x39, 0x33, 0x37, 0x37, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x31,
+  0x39, 0x32, 0x30, 0x34, 0x34, 0x34, 0x33, 0x39, 0x31, 0x37, 0x37, 0x38,
+  0x35, 0x34, 0x30, 0x38, 0x34, 0x32, 0x33, 0x33, 0x36, 0x32, 0x36, 0x36,
+  0x33, 0x31, 0x32, 0x36, 0x30, 0x33, 0x35, 0x2c, 0x20, 0x20, 0x30, 0x2e,
+  0x31, 0x37, 0x32, 0x38, 0x33, 0x35, 0x34, 0x32, 0x39, 0x30, 0x34, 0x35,
+  0x36, 0x33, 0x36, 0x32, 0x32, 0x31, 0x34, 0x36, 0x36, 0x30, 0x35, 0x37,
+  0x34, 0x39, 0x38, 0x30, 0x30, 0x33, 0x38, 0x30, 0x2c, 0x0a, 0x20, 0x20,
+  0x30, 0x2e, 0x31, 0x34, 0x36, 0x39, 0x38, 0x34, 0x34, 0x35, 0x30, 0x33,
+  0x30, 0x32, 0x34, 0x31, 0x39, 0x38, 0x33, 0x39, 0x36, 0x32, 0x31, 0x38,
+  0x30, 0x38, 0x33, 0x38, 0x38, 0x30, 0x37, 0x36, 0x34, 0x31, 0x2c, 0x20,
+  0x20, 0x30, 0x2e, 0x31, 0x31, 0x35, 0x34, 0x38, 0x34, 0x39, 0x34, 0x31,
+  0x35, 0x36, 0x33, 0x39, 0x31, 0x30, 0x38, 0x34, 0x34, 0x35, 0x31, 0x36,
+  0x30, 0x32, 0x32, 0x38, 0x39, 0x38, 0x36, 0x37, 0x34, 0x36, 0x30, 0x2c,
+  0x0a, 0x20, 0x20, 0x30, 0x2e, 0x30, 0x37, 0x39, 0x35, 0x34, 0x37, 0x34,
+  0x31, 0x31, 0x32, 0x38, 0x35, 0x38, 0x30, 0x32, 0x31, 0x32, 0x31, 0x31,
+  0x35, 0x33, 0x38, 0x31, 0x32, 0x39, 0x33, 0x38, 0x36, 0x34, 0x32, 0x36,
+  0x31, 0x30, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x34, 0x30, 0x35, 0x35, 0x32,
+  0x39, 0x31, 0x38, 0x36, 0x30, 0x32, 0x36, 0x38, 0x32, 0x32, 0x31, 0x39,
+  0x30, 0x38, 0x34, 0x30, 0x34, 0x38, 0x30, 0x34, 0x37, 0x32, 0x35, 0x39,
+  0x33, 0x30, 0x36, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x31, 0x32, 0x35,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x2c, 0x20, 0x20, 0x30, 0x2e, 0x31, 0x37,
+  0x33, 0x33, 0x37, 0x39, 0x39, 0x38, 0x30, 0x36, 0x36, 0x35, 0x32, 0x36,
+  0x38, 0x34, 0x33, 0x32, 0x37, 0x32, 0x37, 0x37, 0x30, 0x32, 0x33, 0x39,
+  0x38, 0x39, 0x34, 0x35, 0x38, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e,
+  0x31, 0x36, 0x33, 0x33, 0x32, 0x30, 0x33, 0x37, 0x30, 0x36, 0x30, 0x39,
+  0x35, 0x34, 0x37, 0x30, 0x36, 0x35, 0x39, 0x38, 0x32, 0x30, 0x38, 0x30,
+  0x33, 0x39, 0x36, 0x36, 0x37, 0x38, 0x34, 0x30, 0x2c, 0x20, 0x20, 0x30,
+  0x2e, 0x31, 0x34, 0x36, 0x39, 0x38, 0x34, 0x34, 0x35, 0x30, 0x33, 0x30,
+  0x32, 0x34, 0x31, 0x39, 0x38, 0x33, 0x39, 0x36, 0x32, 0x31, 0x38, 0x30,
+  0x38, 0x33, 0x38, 0x38, 0x30, 0x37, 0x36, 0x34, 0x31, 0x2c, 0x0a, 0x20,
+  0x20, 0x30, 0x2e, 0x31, 0x32, 0x35, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+  0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x2c,
+  0x20, 0x20, 0x30, 0x2e, 0x30, 0x39, 0x38, 0x32, 0x31, 0x31, 0x38, 0x36,
+  0x39, 0x37, 0x39, 0x38, 0x33, 0x38, 0x37, 0x37, 0x37, 0x32, 0x36, 0x35,
+  0x39, 0x37, 0x33, 0x37, 0x31, 0x37, 0x30, 0x39, 0x35, 0x37, 0x31, 0x35,
+  0x32, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x30, 0x36, 0x37, 0x36, 0x34,
+  0x39, 0x35, 0x31, 0x32, 0x35, 0x31, 0x38, 0x32, 0x37, 0x34, 0x36, 0x32,
+  0x33, 0x30, 0x34, 0x39, 0x39, 0x36, 0x35, 0x34, 0x30, 0x30, 0x36, 0x37,
+  0x30, 0x37, 0x39, 0x39, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x33, 0x34, 0x34,
+  0x38, 0x37, 0x34, 0x32, 0x32, 0x34, 0x31, 0x30, 0x33, 0x36, 0x37, 0x38,
+  0x37, 0x36, 0x35, 0x34, 0x31, 0x39, 0x39, 0x34, 0x36, 0x39, 0x35, 0x34,
+  0x35, 0x38, 0x36, 0x37, 0x32, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x30,
+  0x39, 0x38, 0x32, 0x31, 0x31, 0x38, 0x36, 0x39, 0x37, 0x39, 0x38, 0x33,
+  0x38, 0x37, 0x37, 0x37, 0x32, 0x36, 0x35, 0x39, 0x37, 0x33, 0x37, 0x31,
+  0x37, 0x30, 0x39, 0x35, 0x37, 0x31, 0x35, 0x32, 0x2c, 0x20, 0x30, 0x2e,
+  0x31, 0x33, 0x36, 0x32, 0x32, 0x33, 0x37, 0x37, 0x36, 0x36, 0x39, 0x33,
+  0x39, 0x35, 0x34, 0x36, 0x36, 0x32, 0x30, 0x31, 0x36, 0x31, 0x36, 0x33,
+  0x30, 0x34, 0x33, 0x32, 0x36, 0x36, 0x39, 0x31, 0x2c, 0x0a, 0x20, 0x20,
+  0x30, 0x2e, 0x31, 0x32, 0x38, 0x33, 0x31, 0x39, 0x39, 0x39, 0x31, 0x37,
+  0x38, 0x39, 0x38, 0x33, 0x34, 0x31, 0x38, 0x38, 0x31, 0x31, 0x35, 0x38,
+  0x38, 0x34, 0x31, 0x35, 0x35, 0x37, 0x36, 0x31, 0x38, 0x37, 0x2c, 0x20,
+  0x20, 0x30, 0x2e, 0x31, 0x31, 0x35, 0x34, 0x38, 0x34, 0x39, 0x34, 0x31,
+  0x35, 0x36, 0x33, 0x39, 0x31, 0x30, 0x38, 0x34, 0x34, 0x35, 0x31, 0x36,
+  0x30, 0x32, 0x32, 0x38, 0x39, 0x38, 0x36, 0x37, 0x34, 0x36, 0x30, 0x2c,
+  0x0a, 0x20, 0x20, 0x30, 0x2e, 0x30, 0x39, 0x38, 0x32, 0x31, 0x31, 0x38,
+  0x36, 0x39, 0x37, 0x39, 0x38, 0x33, 0x38, 0x37, 0x37, 0x37, 0x32, 0x36,
+  0x35, 0x39, 0x37, 0x33, 0x37, 0x31, 0x37, 0x30, 0x39, 0x35, 0x37, 0x31,
+  0x35, 0x32, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x37, 0x37, 0x31, 0x36, 0x34,
+  0x35, 0x37, 0x30, 0x39, 0x35, 0x34, 0x33, 0x36, 0x33, 0x37, 0x37, 0x38,
+  0x35, 0x33, 0x33, 0x39, 0x34, 0x32, 0x35, 0x30, 0x31, 0x39, 0x39, 0x36,
+  0x32, 0x30, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x30, 0x35, 0x33,
+  0x31, 0x35, 0x31, 0x38, 0x38, 0x30, 0x39, 0x32, 0x32, 0x39, 0x35, 0x33,
+  0x35, 0x32, 0x38, 0x30, 0x34, 0x37, 0x39, 0x31, 0x38, 0x39, 0x32, 0x37,
+  0x37, 0x37, 0x33, 0x32, 0x31, 0x33, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x32,
+  0x37, 0x30, 0x39, 0x36, 0x35, 0x39, 0x33, 0x39, 0x31, 0x35, 0x35, 0x39,
+  0x32, 0x34, 0x30, 0x33, 0x39, 0x36, 0x35, 0x39, 0x31, 0x37, 0x33, 0x35,
+  0x33, 0x34, 0x31, 0x31, 0x34, 0x39, 0x32, 0x2c, 0x0a, 0x20, 0x20, 0x30,
+  0x2e, 0x30, 0x36, 0x37, 0x36, 0x34, 0x39, 0x35, 0x31, 0x32, 0x35, 0x31,
+  0x38, 0x32, 0x37, 0x34, 0x36, 0x32, 0x33, 0x30, 0x34, 0x39, 0x39, 0x36,
+  0x35, 0x34, 0x30, 0x30, 0x36, 0x37, 0x30, 0x37, 0x39, 0x39, 0x2c, 0x20,
+  0x30, 0x2e, 0x30, 0x39, 0x33, 0x38, 0x33, 0x32, 0x35, 0x36, 0x39, 0x33,
+  0x37, 0x39, 0x34, 0x36, 0x36, 0x33, 0x31, 0x31, 0x35, 0x37, 0x33, 0x38,
+  0x38, 0x39, 0x34, 0x36, 0x30, 0x33, 0x30, 0x33, 0x31, 0x39, 0x34, 0x2c,
+  0x0a, 0x20, 0x20, 0x30, 0x2e, 0x30, 0x38, 0x38, 0x33, 0x38, 0x38, 0x33,
+  0x34, 0x37, 0x36, 0x34, 0x38, 0x33, 0x31, 0x38, 0x34, 0x34, 0x30, 0x35,
+  0x35, 0x30, 0x31, 0x30, 0x35, 0x35, 0x34, 0x35, 0x32, 0x36, 0x33, 0x31,
+  0x30, 0x36, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x37, 0x39, 0x35, 0x34, 0x37,
+  0x34, 0x31, 0x31, 0x32, 0x38, 0x35, 0x38, 0x30, 0x32, 0x31, 0x32, 0x31,
+  0x31, 0x35, 0x33, 0x38, 0x31, 0x32, 0x39, 0x33, 0x38, 0x36, 0x34, 0x32,
+  0x36, 0x31, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x30, 0x36, 0x37,
+  0x36, 0x34, 0x39, 0x35, 0x31, 0x32, 0x35, 0x31, 0x38, 0x32, 0x37, 0x34,
+  0x36, 0x32, 0x33, 0x30, 0x34, 0x39, 0x39, 0x36, 0x35, 0x34, 0x30, 0x30,
+  0x36, 0x37, 0x30, 0x37, 0x39, 0x39, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x35,
+  0x33, 0x31, 0x35, 0x31, 0x38, 0x38, 0x30, 0x39, 0x32, 0x32, 0x39, 0x35,
+  0x33, 0x35, 0x32, 0x38, 0x30, 0x34, 0x37, 0x39, 0x31, 0x38, 0x39, 0x32,
+  0x37, 0x37, 0x37, 0x33, 0x32, 0x31, 0x33, 0x2c, 0x0a, 0x20, 0x20, 0x30,
+  0x2e, 0x30, 0x33, 0x36, 0x36, 0x31, 0x31, 0x36, 0x35, 0x32, 0x33, 0x35,
+  0x31, 0x36, 0x38, 0x31, 0x35, 0x35, 0x39, 0x34, 0x34, 0x39, 0x38, 0x39,
+  0x34, 0x34, 0x35, 0x34, 0x37, 0x33, 0x36, 0x38, 0x39, 0x34, 0x2c, 0x20,
+  0x30, 0x2e, 0x30, 0x31, 0x38, 0x36, 0x36, 0x34, 0x34, 0x35, 0x38, 0x35,
+  0x31, 0x32, 0x35, 0x38, 0x35, 0x36, 0x35, 0x31, 0x35, 0x30, 0x35, 0x39,
+  0x32, 0x34, 0x32, 0x33, 0x32, 0x33, 0x31, 0x34, 0x35, 0x34, 0x32, 0x2c,
+  0x0a, 0x20, 0x20, 0x30, 0x2e, 0x30, 0x33, 0x34, 0x34, 0x38, 0x37, 0x34,
+  0x32, 0x32, 0x34, 0x31, 0x30, 0x33, 0x36, 0x37, 0x38, 0x37, 0x36, 0x35,
+  0x34, 0x31, 0x39, 0x39, 0x34, 0x36, 0x39, 0x35, 0x34, 0x35, 0x38, 0x36,
+  0x37, 0x32, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x34, 0x37, 0x38, 0x33, 0x35,
+  0x34, 0x32, 0x39, 0x30, 0x34, 0x35, 0x36, 0x33, 0x36, 0x32, 0x32, 0x31,
+  0x34, 0x36, 0x36, 0x30, 0x35, 0x37, 0x34, 0x39, 0x38, 0x30, 0x30, 0x33,
+  0x38, 0x30, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x30, 0x34, 0x35,
+  0x30, 0x35, 0x39, 0x39, 0x38, 0x38, 0x38, 0x37, 0x35, 0x34, 0x33, 0x34,
+  0x32, 0x34, 0x34, 0x36, 0x31, 0x31, 0x38, 0x31, 0x38, 0x32, 0x34, 0x33,
+  0x31, 0x38, 0x33, 0x39, 0x33, 0x39, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x34,
+  0x30, 0x35, 0x35, 0x32, 0x39, 0x31, 0x38, 0x36, 0x30, 0x32, 0x36, 0x38,
+  0x32, 0x32, 0x31, 0x39, 0x30, 0x38, 0x34, 0x30, 0x34, 0x38, 0x30, 0x34,
+  0x37, 0x32, 0x35, 0x39, 0x33, 0x30, 0x36, 0x2c, 0x0a, 0x20, 0x20, 0x30,
+  0x2e, 0x30, 0x33, 0x34, 0x34, 0x38, 0x37, 0x34, 0x32, 0x32, 0x34, 0x31,
+  0x30, 0x33, 0x36, 0x37, 0x38, 0x37, 0x36, 0x35, 0x34, 0x31, 0x39, 0x39,
+  0x34, 0x36, 0x39, 0x35, 0x34, 0x35, 0x38, 0x36, 0x37, 0x32, 0x2c, 0x20,
+  0x30, 0x2e, 0x30, 0x32, 0x37, 0x30, 0x39, 0x36, 0x35, 0x39, 0x33, 0x39,
+  0x31, 0x35, 0x35, 0x39, 0x32, 0x34, 0x30, 0x33, 0x39, 0x36, 0x35, 0x39,
+  0x31, 0x37, 0x33, 0x35, 0x33, 0x34, 0x31, 0x31, 0x34, 0x39, 0x32, 0x2c,
+  0x0a, 0x20, 0x20, 0x30, 0x2e, 0x30, 0x31, 0x38, 0x36, 0x36, 0x34, 0x34,
+  0x35, 0x38, 0x35, 0x31, 0x32, 0x35, 0x38, 0x35, 0x36, 0x35, 0x31, 0x35,
+  0x30, 0x35, 0x39, 0x32, 0x34, 0x32, 0x33, 0x32, 0x33, 0x31, 0x34, 0x35,
+  0x34, 0x32, 0x2c, 0x20, 0x30, 0x2e, 0x30, 0x30, 0x39, 0x35, 0x31, 0x35,
+  0x30, 0x35, 0x38, 0x34, 0x33, 0x36, 0x30, 0x38, 0x39, 0x31, 0x35, 0x35,
+  0x34, 0x38, 0x33, 0x39, 0x37, 0x37, 0x31, 0x30, 0x31, 0x33, 0x32, 0x35,
+  0x34, 0x30, 0x31, 0x35, 0x0a, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69,
+  0x64, 0x20, 0x67, 0x6c, 0x6a, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f, 0x69,
+  0x64, 0x63, 0x74, 0x38, 0x28, 0x6f, 0x75, 0x74, 0x20, 0x66, 0x6c, 0x6f,
+  0x61, 0x74, 0x20, 0x78, 0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x63, 0x6f, 0x6e,
+  0x73, 0x74, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x79, 0x5b, 0x38,
+  0x5d, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x74, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x74, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x74, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x74, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x74, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x75, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x75, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x75, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x30, 0x20, 0x3d, 0x20,
+  0x79, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x34, 0x20, 0x3d,
+  0x20, 0x79, 0x5b, 0x31, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x32, 0x20,
+  0x3d, 0x20, 0x79, 0x5b, 0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x36,
+  0x20, 0x3d, 0x20, 0x79, 0x5b, 0x33, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x74,
+  0x31, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x34, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x35, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x35, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x74, 0x33, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x36, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x75, 0x37, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x37, 0x5d, 0x3b,
+  0x0a, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x45, 0x6d, 0x62, 0x65, 0x64, 0x64,
+  0x65, 0x64, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e,
+  0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x34, 0x2d, 0x70, 0x6f, 0x69, 0x6e,
+  0x74, 0x20, 0x54, 0x79, 0x70, 0x65, 0x2d, 0x49, 0x49, 0x20, 0x44, 0x43,
+  0x54, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x75, 0x30, 0x20, 0x3d, 0x20,
+  0x74, 0x30, 0x20, 0x2b, 0x20, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x75,
+  0x31, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2d, 0x20, 0x74, 0x31, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x33, 0x20, 0x3d, 0x20, 0x74, 0x32, 0x20, 0x2b,
+  0x20, 0x74, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x32, 0x20, 0x3d, 0x20,
+  0x28, 0x74, 0x32, 0x20, 0x2d, 0x20, 0x74, 0x33, 0x29, 0x2a, 0x31, 0x2e,
+  0x34, 0x31, 0x34, 0x32, 0x31, 0x33, 0x35, 0x36, 0x32, 0x33, 0x37, 0x33,
+  0x30, 0x39, 0x35, 0x30, 0x34, 0x38, 0x38, 0x30, 0x31, 0x36, 0x38, 0x38,
+  0x37, 0x32, 0x34, 0x32, 0x30, 0x39, 0x37, 0x20, 0x2d, 0x20, 0x75, 0x33,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x30, 0x20, 0x3d, 0x20, 0x75, 0x30, 0x20,
+  0x2b, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x33, 0x20, 0x3d,
+  0x20, 0x75, 0x30, 0x20, 0x2d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x31, 0x20, 0x3d, 0x20, 0x75, 0x31, 0x20, 0x2b, 0x20, 0x75, 0x32,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x75, 0x31, 0x20,
+  0x2d, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x45,
+  0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x73, 0x63, 0x61, 0x6c,
+  0x65, 0x64, 0x20, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x34,
+  0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x54, 0x79, 0x70, 0x65, 0x2d,
+  0x49, 0x56, 0x20, 0x44, 0x53, 0x54, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20,
+  0x74, 0x35, 0x20, 0x3d, 0x20, 0x75, 0x35, 0x20, 0x2b, 0x20, 0x75, 0x36,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x36, 0x20, 0x3d, 0x20, 0x75, 0x35, 0x20,
+  0x2d, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x37, 0x20, 0x3d,
+  0x20, 0x75, 0x34, 0x20, 0x2b, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x34, 0x20, 0x3d, 0x20, 0x75, 0x34, 0x20, 0x2d, 0x20, 0x75, 0x37,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x37, 0x20, 0x3d, 0x20, 0x74, 0x37, 0x20,
+  0x2b, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d,
+  0x20, 0x28, 0x74, 0x37, 0x20, 0x2d, 0x20, 0x74, 0x35, 0x29, 0x2a, 0x31,
+  0x2e, 0x34, 0x31, 0x34, 0x32, 0x31, 0x33, 0x35, 0x36, 0x32, 0x33, 0x37,
+  0x33, 0x30, 0x39, 0x35, 0x30, 0x34, 0x38, 0x38, 0x30, 0x31, 0x36, 0x38,
+  0x38, 0x37, 0x32, 0x34, 0x32, 0x30, 0x39, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x38, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x34, 0x20, 0x2b, 0x20, 0x74,
+  0x36, 0x29, 0x2a, 0x31, 0x2e, 0x38, 0x34, 0x37, 0x37, 0x35, 0x39, 0x30,
+  0x36, 0x35, 0x30, 0x32, 0x32, 0x35, 0x37, 0x33, 0x35, 0x31, 0x32, 0x32,
+  0x35, 0x36, 0x33, 0x36, 0x36, 0x33, 0x37, 0x38, 0x37, 0x39, 0x33, 0x36,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x34, 0x20, 0x3d, 0x20, 0x75, 0x38, 0x20,
+  0x2d, 0x20, 0x74, 0x34, 0x2a, 0x31, 0x2e, 0x30, 0x38, 0x32, 0x33, 0x39,
+  0x32, 0x32, 0x30, 0x30, 0x32, 0x39, 0x32, 0x33, 0x39, 0x33, 0x39, 0x36,
+  0x38, 0x37, 0x39, 0x39, 0x34, 0x34, 0x36, 0x34, 0x31, 0x30, 0x37, 0x33,
+  0x32, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20, 0x75,
+  0x38, 0x20, 0x2d, 0x20, 0x74, 0x36, 0x2a, 0x32, 0x2e, 0x36, 0x31, 0x33,
+  0x31, 0x32, 0x35, 0x39, 0x32, 0x39, 0x37, 0x35, 0x32, 0x37, 0x35, 0x33,
+  0x30, 0x35, 0x35, 0x37, 0x31, 0x33, 0x32, 0x38, 0x36, 0x33, 0x34, 0x36,
+  0x38, 0x35, 0x34, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x37, 0x20, 0x3d,
+  0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x36, 0x20, 0x3d, 0x20,
+  0x74, 0x37, 0x20, 0x2d, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x74,
+  0x35, 0x20, 0x3d, 0x20, 0x74, 0x36, 0x20, 0x2b, 0x20, 0x75, 0x35, 0x3b,
+  0x0a, 0x20, 0x20, 0x74, 0x34, 0x20, 0x3d, 0x20, 0x74, 0x35, 0x20, 0x2d,
+  0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x42, 0x75,
+  0x74, 0x74, 0x65, 0x72, 0x66, 0x6c, 0x69, 0x65, 0x73, 0x20, 0x2a, 0x2f,
+  0x0a, 0x20, 0x20, 0x75, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2b,
+  0x20, 0x74, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x37, 0x20, 0x3d, 0x20,
+  0x74, 0x30, 0x20, 0x2d, 0x20, 0x74, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x75,
+  0x36, 0x20, 0x3d, 0x20, 0x74, 0x31, 0x20, 0x2b, 0x20, 0x74, 0x36, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x31, 0x20, 0x2d,
+  0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x32, 0x20, 0x3d, 0x20,
+  0x74, 0x32, 0x20, 0x2b, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x75,
+  0x35, 0x20, 0x3d, 0x20, 0x74, 0x32, 0x20, 0x2d, 0x20, 0x74, 0x35, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x34, 0x20, 0x3d, 0x20, 0x74, 0x33, 0x20, 0x2b,
+  0x20, 0x74, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x33, 0x20, 0x3d, 0x20,
+  0x74, 0x33, 0x20, 0x2d, 0x20, 0x74, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x78,
+  0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x30, 0x3b, 0x0a, 0x20, 0x20,
+  0x78, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x31, 0x3b, 0x0a, 0x20,
+  0x20, 0x78, 0x5b, 0x32, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x32, 0x3b, 0x0a,
+  0x20, 0x20, 0x78, 0x5b, 0x33, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x33, 0x3b,
+  0x0a, 0x20, 0x20, 0x78, 0x5b, 0x34, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x34,
+  0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x35, 0x5d, 0x20, 0x3d, 0x20, 0x75,
+  0x35, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x36, 0x5d, 0x20, 0x3d, 0x20,
+  0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x37, 0x5d, 0x20, 0x3d,
+  0x20, 0x75, 0x37, 0x3b, 0x0a, 0x7d, 0x0a, 0x0a, 0x69, 0x6e, 0x20, 0x76,
+  0x65, 0x63, 0x32, 0x20, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f, 0x72,
+  0x64, 0x3b, 0x0a, 0x0a, 0x6f, 0x75, 0x74, 0x20, 0x76, 0x65, 0x63, 0x34,
+  0x20, 0x68, 0x5f, 0x6c, 0x6f, 0x77, 0x3b, 0x0a, 0x6f, 0x75, 0x74, 0x20,
+  0x76, 0x65, 0x63, 0x34, 0x20, 0x68, 0x5f, 0x68, 0x69, 0x67, 0x68, 0x3b,
+  0x0a, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x73,
+  0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x74, 0x65, 0x78,
+  0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e,
+  0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73,
+  0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f,
+  0x72, 0x64, 0x2e, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x74, 0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63,
+  0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x6a, 0x3d, 0x28, 0x28, 0x74, 0x26, 0x30, 0x78, 0x37,
+  0x29, 0x3c, 0x3c, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x75, 0x3d, 0x28, 0x73, 0x3c, 0x3c, 0x36, 0x29, 0x2b, 0x6a, 0x3b,
+  0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x76, 0x3d, 0x74, 0x3e, 0x3e,
+  0x33, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3b, 0x0a,
+  0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x78, 0x5b, 0x38, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x79, 0x5b,
+  0x38, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69,
+  0x3d, 0x30, 0x3b, 0x69, 0x3c, 0x38, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x79, 0x5b, 0x69, 0x5d, 0x3d, 0x47,
+  0x4c, 0x4a, 0x5f, 0x52, 0x45, 0x41, 0x4c, 0x5f, 0x49, 0x44, 0x43, 0x54,
+  0x38, 0x58, 0x38, 0x5f, 0x53, 0x43, 0x41, 0x4c, 0x45, 0x53, 0x5b, 0x6a,
+  0x2b, 0x69, 0x5d, 0x2a, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74,
+  0x63, 0x68, 0x28, 0x74, 0x65, 0x78, 0x2c, 0x69, 0x76, 0x65, 0x63, 0x32,
+  0x28, 0x75, 0x2b, 0x69, 0x2c, 0x76, 0x29, 0x2c, 0x30, 0x29, 0x2e, 0x72,
+  0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x67, 0x6c, 0x6a, 0x5f,
+  0x72, 0x65, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x63, 0x74, 0x38, 0x28, 0x78,
+  0x2c, 0x20, 0x79, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x5f, 0x6c, 0x6f,
+  0x77, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x78, 0x5b, 0x30, 0x5d, 0x2c,
+  0x78, 0x5b, 0x31, 0x5d, 0x2c, 0x78, 0x5b, 0x32, 0x5d, 0x2c, 0x78, 0x5b,
+  0x33, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68, 0x5f, 0x68, 0x69, 0x67,
+  0x68, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x78, 0x5b, 0x34, 0x5d, 0x2c,
+  0x78, 0x5b, 0x35, 0x5d, 0x2c, 0x78, 0x5b, 0x36, 0x5d, 0x2c, 0x78, 0x5b,
+  0x37, 0x5d, 0x29, 0x3b, 0x0a, 0x7d, 0x0a
+, 0x00 };
+static const char HORZ_PACK_GREY_FS[] = {
+  0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34, 0x30,
+  0x0a, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x44, 0x45, 0x5f, 0x5a, 0x49, 0x47,
+  0x5f, 0x5a, 0x41, 0x47, 0x5b, 0x36, 0x34, 0x5d, 0x20, 0x3d, 0x20, 0x69,
+  0x6e, 0x74, 0x5b, 0x5d, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20,
+  0x20, 0x31, 0x2c, 0x20, 0x20, 0x38, 0x2c, 0x20, 0x31, 0x36, 0x2c, 0x20,
+  0x20, 0x39, 0x2c, 0x20, 0x20, 0x32, 0x2c, 0x20, 0x20, 0x33, 0x2c, 0x20,
+  0x31, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x31, 0x37, 0x2c, 0x20, 0x32, 0x34,
+  0x2c, 0x20, 0x33, 0x32, 0x2c, 0x20, 0x32, 0x35, 0x2c, 0x20, 0x31, 0x38,
+  0x2c, 0x20, 0x31, 0x31, 0x2c, 0x20, 0x20, 0x34, 0x2c, 0x20, 0x20, 0x35,
+  0x2c, 0x0a, 0x20, 0x20, 0x31, 0x32, 0x2c, 0x20, 0x31, 0x39, 0x2c, 0x20,
+  0x32, 0x36, 0x2c, 0x20, 0x33, 0x33, 0x2c, 0x20, 0x34, 0x30, 0x2c, 0x20,
+  0x34, 0x38, 0x2c, 0x20, 0x34, 0x31, 0x2c, 0x20, 0x33, 0x34, 0x2c, 0x0a,
+  0x20, 0x20, 0x32, 0x37, 0x2c, 0x20, 0x32, 0x30, 0x2c, 0x20, 0x31, 0x33,
+  0x2c, 0x20, 0x20, 0x36, 0x2c, 0x20, 0x20, 0x37, 0x2c, 0x20, 0x31, 0x34,
+  0x2c, 0x20, 0x32, 0x31, 0x2c, 0x20, 0x32, 0x38, 0x2c, 0x0a, 0x20, 0x20,
+  0x33, 0x35, 0x2c, 0x20, 0x34, 0x32, 0x2c, 0x20, 0x34, 0x39, 0x2c, 0x20,
+  0x35, 0x36, 0x2c, 0x20, 0x35, 0x37, 0x2c, 0x20, 0x35, 0x30, 0x2c, 0x20,
+  0x34, 0x33, 0x2c, 0x20, 0x33, 0x36, 0x2c, 0x0a, 0x20, 0x20, 0x32, 0x39,
+  0x2c, 0x20, 0x32, 0x32, 0x2c, 0x20, 0x31, 0x35, 0x2c, 0x20, 0x32, 0x33,
+  0x2c, 0x20, 0x33, 0x30, 0x2c, 0x20, 0x33, 0x37, 0x2c, 0x20, 0x34, 0x34,
+  0x2c, 0x20, 0x35, 0x31, 0x2c, 0x0a, 0x20, 0x20, 0x35, 0x38, 0x2c, 0x20,
+  0x35, 0x39, 0x2c, 0x20, 0x35, 0x32, 0x2c, 0x20, 0x34, 0x35, 0x2c, 0x20,
+  0x33, 0x38, 0x2c, 0x20, 0x33, 0x31, 0x2c, 0x20, 0x33, 0x39, 0x2c, 0x20,
+  0x34, 0x36, 0x2c, 0x0a, 0x20, 0x20, 0x35, 0x33, 0x2c, 0x20, 0x36, 0x30,
+  0x2c, 0x20, 0x36, 0x31, 0x2c, 0x20, 0x35, 0x34, 0x2c, 0x20, 0x34, 0x37,
+  0x2c, 0x20, 0x35, 0x35, 0x2c, 0x20, 0x36, 0x32, 0x2c, 0x20, 0x36, 0x33,
+  0x0a, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x67, 0x6c,
+  0x6a, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x63, 0x74, 0x38,
+  0x28, 0x6f, 0x75, 0x74, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x78,
+  0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x66,
+  0x6c, 0x6f, 0x61, 0x74, 0x20, 0x79, 0x5b, 0x38, 0x5d, 0x29, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x30, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x31, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x32, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x33, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x34, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x35, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x36, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x37, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x30, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x31, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x32, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x33, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x34, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x35, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x36, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x37, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x38, 0x3b,
+  0x0a, 0x20, 0x20, 0x74, 0x30, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x30, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x34, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x31,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x79, 0x5b,
+  0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20, 0x79,
+  0x5b, 0x33, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x31, 0x20, 0x3d, 0x20,
+  0x79, 0x5b, 0x34, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d,
+  0x20, 0x79, 0x5b, 0x35, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x33, 0x20,
+  0x3d, 0x20, 0x79, 0x5b, 0x36, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x37,
+  0x20, 0x3d, 0x20, 0x79, 0x5b, 0x37, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x2f,
+  0x2a, 0x20, 0x45, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x73,
+  0x63, 0x61, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73,
+  0x65, 0x20, 0x34, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x54, 0x79,
+  0x70, 0x65, 0x2d, 0x49, 0x49, 0x20, 0x44, 0x43, 0x54, 0x20, 0x2a, 0x2f,
+  0x0a, 0x20, 0x20, 0x75, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2b,
+  0x20, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x31, 0x20, 0x3d, 0x20,
+  0x74, 0x30, 0x20, 0x2d, 0x20, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x75,
+  0x33, 0x20, 0x3d, 0x20, 0x74, 0x32, 0x20, 0x2b, 0x20, 0x74, 0x33, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x32, 0x20,
+  0x2d, 0x20, 0x74, 0x33, 0x29, 0x2a, 0x31, 0x2e, 0x34, 0x31, 0x34, 0x32,
+  0x31, 0x33, 0x35, 0x36, 0x32, 0x33, 0x37, 0x33, 0x30, 0x39, 0x35, 0x30,
+  0x34, 0x38, 0x38, 0x30, 0x31, 0x36, 0x38, 0x38, 0x37, 0x32, 0x34, 0x32,
+  0x30, 0x39, 0x37, 0x20, 0x2d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x30, 0x20, 0x3d, 0x20, 0x75, 0x30, 0x20, 0x2b, 0x20, 0x75, 0x33,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x33, 0x20, 0x3d, 0x20, 0x75, 0x30, 0x20,
+  0x2d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x31, 0x20, 0x3d,
+  0x20, 0x75, 0x31, 0x20, 0x2b, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x32, 0x20, 0x3d, 0x20, 0x75, 0x31, 0x20, 0x2d, 0x20, 0x75, 0x32,
+  0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x45, 0x6d, 0x62, 0x65, 0x64,
+  0x64, 0x65, 0x64, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 0x20, 0x69,
+  0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x34, 0x2d, 0x70, 0x6f, 0x69,
+  0x6e, 0x74, 0x20, 0x54, 0x79, 0x70, 0x65, 0x2d, 0x49, 0x56, 0x20, 0x44,
+  0x53, 0x54, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x74, 0x35, 0x20, 0x3d,
+  0x20, 0x75, 0x35, 0x20, 0x2b, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x36, 0x20, 0x3d, 0x20, 0x75, 0x35, 0x20, 0x2d, 0x20, 0x75, 0x36,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x37, 0x20, 0x3d, 0x20, 0x75, 0x34, 0x20,
+  0x2b, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x34, 0x20, 0x3d,
+  0x20, 0x75, 0x34, 0x20, 0x2d, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x37, 0x20, 0x3d, 0x20, 0x74, 0x37, 0x20, 0x2b, 0x20, 0x74, 0x35,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x37,
+  0x20, 0x2d, 0x20, 0x74, 0x35, 0x29, 0x2a, 0x31, 0x2e, 0x34, 0x31, 0x34,
+  0x32, 0x31, 0x33, 0x35, 0x36, 0x32, 0x33, 0x37, 0x33, 0x30, 0x39, 0x35,
+  0x30, 0x34, 0x38, 0x38, 0x30, 0x31, 0x36, 0x38, 0x38, 0x37, 0x32, 0x34,
+  0x32, 0x30, 0x39, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x38, 0x20, 0x3d,
+  0x20, 0x28, 0x74, 0x34, 0x20, 0x2b, 0x20, 0x74, 0x36, 0x29, 0x2a, 0x31,
+  0x2e, 0x38, 0x34, 0x37, 0x37, 0x35, 0x39, 0x30, 0x36, 0x35, 0x30, 0x32,
+  0x32, 0x35, 0x37, 0x33, 0x35, 0x31, 0x32, 0x32, 0x35, 0x36, 0x33, 0x36,
+  0x36, 0x33, 0x37, 0x38, 0x37, 0x39, 0x33, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x34, 0x20, 0x3d, 0x20, 0x75, 0x38, 0x20, 0x2d, 0x20, 0x74, 0x34,
+  0x2a, 0x31, 0x2e, 0x30, 0x38, 0x32, 0x33, 0x39, 0x32, 0x32, 0x30, 0x30,
+  0x32, 0x39, 0x32, 0x33, 0x39, 0x33, 0x39, 0x36, 0x38, 0x37, 0x39, 0x39,
+  0x34, 0x34, 0x36, 0x34, 0x31, 0x30, 0x37, 0x33, 0x32, 0x38, 0x3b, 0x0a,
+  0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20, 0x75, 0x38, 0x20, 0x2d, 0x20,
+  0x74, 0x36, 0x2a, 0x32, 0x2e, 0x36, 0x31, 0x33, 0x31, 0x32, 0x35, 0x39,
+  0x32, 0x39, 0x37, 0x35, 0x32, 0x37, 0x35, 0x33, 0x30, 0x35, 0x35, 0x37,
+  0x31, 0x33, 0x32, 0x38, 0x36, 0x33, 0x34, 0x36, 0x38, 0x35, 0x34, 0x34,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x37, 0x20, 0x3d, 0x20, 0x75, 0x37, 0x3b,
+  0x0a, 0x20, 0x20, 0x74, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x37, 0x20, 0x2d,
+  0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x35, 0x20, 0x3d, 0x20,
+  0x74, 0x36, 0x20, 0x2b, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x74,
+  0x34, 0x20, 0x3d, 0x20, 0x74, 0x35, 0x20, 0x2d, 0x20, 0x75, 0x34, 0x3b,
+  0x0a, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x42, 0x75, 0x74, 0x74, 0x65, 0x72,
+  0x66, 0x6c, 0x69, 0x65, 0x73, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x75,
+  0x30, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2b, 0x20, 0x74, 0x37, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x37, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2d,
+  0x20, 0x74, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20,
+  0x74, 0x31, 0x20, 0x2b, 0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x75,
+  0x31, 0x20, 0x3d, 0x20, 0x74, 0x31, 0x20, 0x2d, 0x20, 0x74, 0x36, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x32, 0x20, 0x3d, 0x20, 0x74, 0x32, 0x20, 0x2b,
+  0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d, 0x20,
+  0x74, 0x32, 0x20, 0x2d, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x75,
+  0x34, 0x20, 0x3d, 0x20, 0x74, 0x33, 0x20, 0x2b, 0x20, 0x74, 0x34, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x33, 0x20, 0x3d, 0x20, 0x74, 0x33, 0x20, 0x2d,
+  0x20, 0x74, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x30, 0x5d, 0x20,
+  0x3d, 0x20, 0x75, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x31, 0x5d,
+  0x20, 0x3d, 0x20, 0x75, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x32,
+  0x5d, 0x20, 0x3d, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b,
+  0x33, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x78,
+  0x5b, 0x34, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x78, 0x5b, 0x35, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20,
+  0x20, 0x78, 0x5b, 0x36, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x36, 0x3b, 0x0a,
+  0x20, 0x20, 0x78, 0x5b, 0x37, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x37, 0x3b,
+  0x0a, 0x7d, 0x0a, 0x0a, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20,
+  0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x0a,
+  0x6f, 0x75, 0x74, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x68, 0x5f, 0x6c,
+  0x6f, 0x77, 0x3b, 0x0a, 0x6f, 0x75, 0x74, 0x20, 0x76, 0x65, 0x63, 0x34,
+  0x20, 0x68, 0x5f, 0x68, 0x69, 0x67, 0x68, 0x3b, 0x0a, 0x0a, 0x75, 0x6e,
+  0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x79, 0x5f,
+  0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66,
+  0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x42,
+  0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x3b,
+  0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x73, 0x61,
+  0x6d, 0x70, 0x6c, 0x65, 0x72, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20,
+  0x69, 0x6e, 0x64, 0x65, 0x78, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f,
+  0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x42,
+  0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x3b, 0x0a,
+  0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x5b, 0x38,
+  0x2a, 0x38, 0x5d, 0x2f, 0x2a, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x5b,
+  0x5d, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x29, 0x2a, 0x2f, 0x3b,
+  0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x20, 0x3d, 0x20, 0x69,
+  0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64,
+  0x2e, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63,
+  0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c,
+  0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x69, 0x6e, 0x64, 0x65, 0x78, 0x2c,
+  0x20, 0x28, 0x74, 0x3e, 0x3e, 0x33, 0x29, 0x2a, 0x28, 0x79, 0x5f, 0x73,
+  0x74, 0x72, 0x69, 0x64, 0x65, 0x3e, 0x3e, 0x33, 0x29, 0x20, 0x2b, 0x20,
+  0x73, 0x29, 0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x20, 0x70, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65,
+  0x74, 0x63, 0x68, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x2c, 0x20, 0x69, 0x29,
+  0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x2b, 0x2b, 0x3b, 0x0a, 0x20,
+  0x20, 0x69, 0x6e, 0x74, 0x20, 0x6a, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x0a,
+  0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6a, 0x3d, 0x30, 0x3b, 0x6a,
+  0x3c, 0x36, 0x34, 0x3b, 0x6a, 0x2b, 0x2b, 0x29, 0x20, 0x62, 0x5b, 0x6a,
+  0x5d, 0x3d, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x6a, 0x3d, 0x30, 0x3b, 0x0a,
+  0x20, 0x20, 0x62, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74,
+  0x28, 0x70, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x70, 0x20, 0x26, 0x20, 0x75,
+  0x69, 0x6e, 0x74, 0x28, 0x30, 0x78, 0x30, 0x38, 0x30, 0x30, 0x29, 0x29,
+  0x20, 0x3d, 0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x30, 0x78, 0x30,
+  0x38, 0x30, 0x30, 0x29, 0x20, 0x3f, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28,
+  0x7e, 0x30, 0x78, 0x66, 0x66, 0x66, 0x29, 0x20, 0x3a, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x28, 0x30, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x6c, 0x65, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x77, 0x68,
+  0x69, 0x6c, 0x65, 0x20, 0x28, 0x6a, 0x20, 0x3c, 0x20, 0x36, 0x33, 0x29,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3d, 0x20, 0x74,
+  0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x70, 0x61,
+  0x63, 0x6b, 0x2c, 0x20, 0x69, 0x29, 0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x69, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x70, 0x20, 0x3d, 0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x28, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x65, 0x6e, 0x20, 0x3d, 0x20,
+  0x69, 0x6e, 0x74, 0x28, 0x28, 0x70, 0x20, 0x3e, 0x3e, 0x20, 0x31, 0x32,
+  0x29, 0x20, 0x26, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x30, 0x78, 0x66,
+  0x29, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x70, 0x20, 0x26, 0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x30, 0x78,
+  0x66, 0x66, 0x66, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6e,
+  0x74, 0x20, 0x63, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x70, 0x20,
+  0x7c, 0x20, 0x28, 0x28, 0x70, 0x20, 0x26, 0x20, 0x75, 0x69, 0x6e, 0x74,
+  0x28, 0x30, 0x78, 0x30, 0x38, 0x30, 0x30, 0x29, 0x29, 0x20, 0x3d, 0x3d,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x30, 0x78, 0x30, 0x38, 0x30, 0x30,
+  0x29, 0x20, 0x3f, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x7e, 0x30, 0x78,
+  0x66, 0x66, 0x66, 0x29, 0x20, 0x3a, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28,
+  0x30, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6a, 0x20,
+  0x2b, 0x3d, 0x20, 0x6c, 0x65, 0x6e, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x62, 0x5b, 0x44, 0x45, 0x5f, 0x5a, 0x49, 0x47, 0x5f, 0x5a, 0x41, 0x47,
+  0x5b, 0x6a, 0x5d, 0x5d, 0x20, 0x3d, 0x20, 0x63, 0x3b, 0x0a, 0x20, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x6a, 0x20, 0x3d, 0x20, 0x28, 0x28, 0x74, 0x20,
+  0x26, 0x20, 0x30, 0x78, 0x37, 0x29, 0x20, 0x3c, 0x3c, 0x20, 0x33, 0x29,
+  0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x78, 0x5b,
+  0x38, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20,
+  0x79, 0x5b, 0x38, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20,
+  0x28, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20,
+  0x38, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x73, 0x63, 0x61, 0x6c,
+  0x65, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74,
+  0x63, 0x68, 0x28, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x2c, 0x20, 0x6a, 0x20,
+  0x2b, 0x20, 0x69, 0x29, 0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x79, 0x5b, 0x69, 0x5d, 0x3d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x2a, 0x62,
+  0x5b, 0x6a, 0x20, 0x2b, 0x20, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x67, 0x6c, 0x6a, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f,
+  0x69, 0x64, 0x63, 0x74, 0x38, 0x28, 0x78, 0x2c, 0x20, 0x79, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x68, 0x5f, 0x6c, 0x6f, 0x77, 0x3d, 0x76, 0x65, 0x63,
+  0x34, 0x28, 0x78, 0x5b, 0x30, 0x5d, 0x2c, 0x78, 0x5b, 0x31, 0x5d, 0x2c,
+  0x78, 0x5b, 0x32, 0x5d, 0x2c, 0x78, 0x5b, 0x33, 0x5d, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x68, 0x5f, 0x68, 0x69, 0x67, 0x68, 0x3d, 0x76, 0x65, 0x63,
+  0x34, 0x28, 0x78, 0x5b, 0x34, 0x5d, 0x2c, 0x78, 0x5b, 0x35, 0x5d, 0x2c,
+  0x78, 0x5b, 0x36, 0x5d, 0x2c, 0x78, 0x5b, 0x37, 0x5d, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x2f, 0x2a, 0x69, 0x66, 0x20, 0x28, 0x74, 0x3e, 0x2d, 0x31,
+  0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x5f, 0x6c, 0x6f,
+  0x77, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x6a, 0x2c, 0x30, 0x2c, 0x30,
+  0x2c, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x5f, 0x68,
+  0x69, 0x67, 0x68, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x74, 0x2c, 0x31,
+  0x2c, 0x31, 0x2c, 0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68,
+  0x5f, 0x6c, 0x6f, 0x77, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x62, 0x5b,
+  0x6a, 0x2b, 0x30, 0x5d, 0x2c, 0x62, 0x5b, 0x6a, 0x2b, 0x31, 0x5d, 0x2c,
+  0x62, 0x5b, 0x6a, 0x2b, 0x32, 0x5d, 0x2c, 0x62, 0x5b, 0x6a, 0x2b, 0x33,
+  0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x5f, 0x68, 0x69,
+  0x67, 0x68, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x62, 0x5b, 0x6a, 0x2b,
+  0x34, 0x5d, 0x2c, 0x62, 0x5b, 0x6a, 0x2b, 0x35, 0x5d, 0x2c, 0x62, 0x5b,
+  0x6a, 0x2b, 0x36, 0x5d, 0x2c, 0x62, 0x5b, 0x6a, 0x2b, 0x37, 0x5d, 0x29,
+  0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x2a, 0x2f, 0x0a, 0x20, 0x7d, 0x0a
+, 0x00 };
+static const char HORZ_PACK_YUV_FS[] = {
+  0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34, 0x30,
+  0x0a, 0x0a, 0x69, 0x6e, 0x74, 0x20, 0x44, 0x45, 0x5f, 0x5a, 0x49, 0x47,
+  0x5f, 0x5a, 0x41, 0x47, 0x5b, 0x36, 0x34, 0x5d, 0x20, 0x3d, 0x20, 0x69,
+  0x6e, 0x74, 0x5b, 0x5d, 0x28, 0x0a, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20,
+  0x20, 0x31, 0x2c, 0x20, 0x20, 0x38, 0x2c, 0x20, 0x31, 0x36, 0x2c, 0x20,
+  0x20, 0x39, 0x2c, 0x20, 0x20, 0x32, 0x2c, 0x20, 0x20, 0x33, 0x2c, 0x20,
+  0x31, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x31, 0x37, 0x2c, 0x20, 0x32, 0x34,
+  0x2c, 0x20, 0x33, 0x32, 0x2c, 0x20, 0x32, 0x35, 0x2c, 0x20, 0x31, 0x38,
+  0x2c, 0x20, 0x31, 0x31, 0x2c, 0x20, 0x20, 0x34, 0x2c, 0x20, 0x20, 0x35,
+  0x2c, 0x0a, 0x20, 0x20, 0x31, 0x32, 0x2c, 0x20, 0x31, 0x39, 0x2c, 0x20,
+  0x32, 0x36, 0x2c, 0x20, 0x33, 0x33, 0x2c, 0x20, 0x34, 0x30, 0x2c, 0x20,
+  0x34, 0x38, 0x2c, 0x20, 0x34, 0x31, 0x2c, 0x20, 0x33, 0x34, 0x2c, 0x0a,
+  0x20, 0x20, 0x32, 0x37, 0x2c, 0x20, 0x32, 0x30, 0x2c, 0x20, 0x31, 0x33,
+  0x2c, 0x20, 0x20, 0x36, 0x2c, 0x20, 0x20, 0x37, 0x2c, 0x20, 0x31, 0x34,
+  0x2c, 0x20, 0x32, 0x31, 0x2c, 0x20, 0x32, 0x38, 0x2c, 0x0a, 0x20, 0x20,
+  0x33, 0x35, 0x2c, 0x20, 0x34, 0x32, 0x2c, 0x20, 0x34, 0x39, 0x2c, 0x20,
+  0x35, 0x36, 0x2c, 0x20, 0x35, 0x37, 0x2c, 0x20, 0x35, 0x30, 0x2c, 0x20,
+  0x34, 0x33, 0x2c, 0x20, 0x33, 0x36, 0x2c, 0x0a, 0x20, 0x20, 0x32, 0x39,
+  0x2c, 0x20, 0x32, 0x32, 0x2c, 0x20, 0x31, 0x35, 0x2c, 0x20, 0x32, 0x33,
+  0x2c, 0x20, 0x33, 0x30, 0x2c, 0x20, 0x33, 0x37, 0x2c, 0x20, 0x34, 0x34,
+  0x2c, 0x20, 0x35, 0x31, 0x2c, 0x0a, 0x20, 0x20, 0x35, 0x38, 0x2c, 0x20,
+  0x35, 0x39, 0x2c, 0x20, 0x35, 0x32, 0x2c, 0x20, 0x34, 0x35, 0x2c, 0x20,
+  0x33, 0x38, 0x2c, 0x20, 0x33, 0x31, 0x2c, 0x20, 0x33, 0x39, 0x2c, 0x20,
+  0x34, 0x36, 0x2c, 0x0a, 0x20, 0x20, 0x35, 0x33, 0x2c, 0x20, 0x36, 0x30,
+  0x2c, 0x20, 0x36, 0x31, 0x2c, 0x20, 0x35, 0x34, 0x2c, 0x20, 0x34, 0x37,
+  0x2c, 0x20, 0x35, 0x35, 0x2c, 0x20, 0x36, 0x32, 0x2c, 0x20, 0x36, 0x33,
+  0x0a, 0x29, 0x3b, 0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x67, 0x6c,
+  0x6a, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x63, 0x74, 0x38,
+  0x28, 0x6f, 0x75, 0x74, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x78,
+  0x5b, 0x38, 0x5d, 0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x66,
+  0x6c, 0x6f, 0x61, 0x74, 0x20, 0x79, 0x5b, 0x38, 0x5d, 0x29, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x30, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x31, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x32, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x33, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x34, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x35, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x36, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x37, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x30, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x31, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x32, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x33, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x34, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x35, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x36, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x37, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x38, 0x3b,
+  0x0a, 0x20, 0x20, 0x74, 0x30, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x30, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x34, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x31,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x79, 0x5b,
+  0x32, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20, 0x79,
+  0x5b, 0x33, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x31, 0x20, 0x3d, 0x20,
+  0x79, 0x5b, 0x34, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d,
+  0x20, 0x79, 0x5b, 0x35, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x33, 0x20,
+  0x3d, 0x20, 0x79, 0x5b, 0x36, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x37,
+  0x20, 0x3d, 0x20, 0x79, 0x5b, 0x37, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x2f,
+  0x2a, 0x20, 0x45, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x73,
+  0x63, 0x61, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73,
+  0x65, 0x20, 0x34, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x54, 0x79,
+  0x70, 0x65, 0x2d, 0x49, 0x49, 0x20, 0x44, 0x43, 0x54, 0x20, 0x2a, 0x2f,
+  0x0a, 0x20, 0x20, 0x75, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2b,
+  0x20, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x31, 0x20, 0x3d, 0x20,
+  0x74, 0x30, 0x20, 0x2d, 0x20, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x75,
+  0x33, 0x20, 0x3d, 0x20, 0x74, 0x32, 0x20, 0x2b, 0x20, 0x74, 0x33, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x32, 0x20,
+  0x2d, 0x20, 0x74, 0x33, 0x29, 0x2a, 0x31, 0x2e, 0x34, 0x31, 0x34, 0x32,
+  0x31, 0x33, 0x35, 0x36, 0x32, 0x33, 0x37, 0x33, 0x30, 0x39, 0x35, 0x30,
+  0x34, 0x38, 0x38, 0x30, 0x31, 0x36, 0x38, 0x38, 0x37, 0x32, 0x34, 0x32,
+  0x30, 0x39, 0x37, 0x20, 0x2d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x30, 0x20, 0x3d, 0x20, 0x75, 0x30, 0x20, 0x2b, 0x20, 0x75, 0x33,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x33, 0x20, 0x3d, 0x20, 0x75, 0x30, 0x20,
+  0x2d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x31, 0x20, 0x3d,
+  0x20, 0x75, 0x31, 0x20, 0x2b, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x32, 0x20, 0x3d, 0x20, 0x75, 0x31, 0x20, 0x2d, 0x20, 0x75, 0x32,
+  0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x45, 0x6d, 0x62, 0x65, 0x64,
+  0x64, 0x65, 0x64, 0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 0x20, 0x69,
+  0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x34, 0x2d, 0x70, 0x6f, 0x69,
+  0x6e, 0x74, 0x20, 0x54, 0x79, 0x70, 0x65, 0x2d, 0x49, 0x56, 0x20, 0x44,
+  0x53, 0x54, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x74, 0x35, 0x20, 0x3d,
+  0x20, 0x75, 0x35, 0x20, 0x2b, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x36, 0x20, 0x3d, 0x20, 0x75, 0x35, 0x20, 0x2d, 0x20, 0x75, 0x36,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x37, 0x20, 0x3d, 0x20, 0x75, 0x34, 0x20,
+  0x2b, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x34, 0x20, 0x3d,
+  0x20, 0x75, 0x34, 0x20, 0x2d, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x37, 0x20, 0x3d, 0x20, 0x74, 0x37, 0x20, 0x2b, 0x20, 0x74, 0x35,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x37,
+  0x20, 0x2d, 0x20, 0x74, 0x35, 0x29, 0x2a, 0x31, 0x2e, 0x34, 0x31, 0x34,
+  0x32, 0x31, 0x33, 0x35, 0x36, 0x32, 0x33, 0x37, 0x33, 0x30, 0x39, 0x35,
+  0x30, 0x34, 0x38, 0x38, 0x30, 0x31, 0x36, 0x38, 0x38, 0x37, 0x32, 0x34,
+  0x32, 0x30, 0x39, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x38, 0x20, 0x3d,
+  0x20, 0x28, 0x74, 0x34, 0x20, 0x2b, 0x20, 0x74, 0x36, 0x29, 0x2a, 0x31,
+  0x2e, 0x38, 0x34, 0x37, 0x37, 0x35, 0x39, 0x30, 0x36, 0x35, 0x30, 0x32,
+  0x32, 0x35, 0x37, 0x33, 0x35, 0x31, 0x32, 0x32, 0x35, 0x36, 0x33, 0x36,
+  0x36, 0x33, 0x37, 0x38, 0x37, 0x39, 0x33, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x34, 0x20, 0x3d, 0x20, 0x75, 0x38, 0x20, 0x2d, 0x20, 0x74, 0x34,
+  0x2a, 0x31, 0x2e, 0x30, 0x38, 0x32, 0x33, 0x39, 0x32, 0x32, 0x30, 0x30,
+  0x32, 0x39, 0x32, 0x33, 0x39, 0x33, 0x39, 0x36, 0x38, 0x37, 0x39, 0x39,
+  0x34, 0x34, 0x36, 0x34, 0x31, 0x30, 0x37, 0x33, 0x32, 0x38, 0x3b, 0x0a,
+  0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20, 0x75, 0x38, 0x20, 0x2d, 0x20,
+  0x74, 0x36, 0x2a, 0x32, 0x2e, 0x36, 0x31, 0x33, 0x31, 0x32, 0x35, 0x39,
+  0x32, 0x39, 0x37, 0x35, 0x32, 0x37, 0x35, 0x33, 0x30, 0x35, 0x35, 0x37,
+  0x31, 0x33, 0x32, 0x38, 0x36, 0x33, 0x34, 0x36, 0x38, 0x35, 0x34, 0x34,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x37, 0x20, 0x3d, 0x20, 0x75, 0x37, 0x3b,
+  0x0a, 0x20, 0x20, 0x74, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x37, 0x20, 0x2d,
+  0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x35, 0x20, 0x3d, 0x20,
+  0x74, 0x36, 0x20, 0x2b, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x74,
+  0x34, 0x20, 0x3d, 0x20, 0x74, 0x35, 0x20, 0x2d, 0x20, 0x75, 0x34, 0x3b,
+  0x0a, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x42, 0x75, 0x74, 0x74, 0x65, 0x72,
+  0x66, 0x6c, 0x69, 0x65, 0x73, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x75,
+  0x30, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2b, 0x20, 0x74, 0x37, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x37, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2d,
+  0x20, 0x74, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20,
+  0x74, 0x31, 0x20, 0x2b, 0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x75,
+  0x31, 0x20, 0x3d, 0x20, 0x74, 0x31, 0x20, 0x2d, 0x20, 0x74, 0x36, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x32, 0x20, 0x3d, 0x20, 0x74, 0x32, 0x20, 0x2b,
+  0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d, 0x20,
+  0x74, 0x32, 0x20, 0x2d, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x75,
+  0x34, 0x20, 0x3d, 0x20, 0x74, 0x33, 0x20, 0x2b, 0x20, 0x74, 0x34, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x33, 0x20, 0x3d, 0x20, 0x74, 0x33, 0x20, 0x2d,
+  0x20, 0x74, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x30, 0x5d, 0x20,
+  0x3d, 0x20, 0x75, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x31, 0x5d,
+  0x20, 0x3d, 0x20, 0x75, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x32,
+  0x5d, 0x20, 0x3d, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b,
+  0x33, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x78,
+  0x5b, 0x34, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x78, 0x5b, 0x35, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20,
+  0x20, 0x78, 0x5b, 0x36, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x36, 0x3b, 0x0a,
+  0x20, 0x20, 0x78, 0x5b, 0x37, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x37, 0x3b,
+  0x0a, 0x7d, 0x0a, 0x0a, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20,
+  0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x0a,
+  0x6f, 0x75, 0x74, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x68, 0x5f, 0x6c,
+  0x6f, 0x77, 0x3b, 0x0a, 0x6f, 0x75, 0x74, 0x20, 0x76, 0x65, 0x63, 0x34,
+  0x20, 0x68, 0x5f, 0x68, 0x69, 0x67, 0x68, 0x3b, 0x0a, 0x0a, 0x75, 0x6e,
+  0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x79, 0x5f,
+  0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66,
+  0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x75, 0x5f, 0x63, 0x73,
+  0x74, 0x72, 0x69, 0x64, 0x65, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f,
+  0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x76, 0x5f, 0x63, 0x73, 0x74,
+  0x72, 0x69, 0x64, 0x65, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72,
+  0x6d, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x42, 0x75, 0x66,
+  0x66, 0x65, 0x72, 0x20, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x3b, 0x0a, 0x75,
+  0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x73, 0x61, 0x6d, 0x70,
+  0x6c, 0x65, 0x72, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x69, 0x6e,
+  0x64, 0x65, 0x78, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d,
+  0x20, 0x75, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x42, 0x75, 0x66,
+  0x66, 0x65, 0x72, 0x20, 0x70, 0x61, 0x63, 0x6b, 0x3b, 0x0a, 0x0a, 0x76,
+  0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x62, 0x5b, 0x38, 0x2a, 0x38,
+  0x5d, 0x2f, 0x2a, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x5b, 0x5d, 0x28,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x30, 0x2c, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x30, 0x2c, 0x20, 0x20,
+  0x20, 0x20, 0x30, 0x0a, 0x20, 0x20, 0x29, 0x2a, 0x2f, 0x3b, 0x0a, 0x20,
+  0x20, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74,
+  0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x73,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x20, 0x3d,
+  0x20, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f,
+  0x72, 0x64, 0x2e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x76, 0x20, 0x3d, 0x20, 0x74, 0x3e, 0x3e, 0x33, 0x3b, 0x0a, 0x20,
+  0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78,
+  0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x69, 0x6e, 0x64, 0x65,
+  0x78, 0x2c, 0x20, 0x28, 0x74, 0x3e, 0x3e, 0x33, 0x29, 0x2a, 0x28, 0x79,
+  0x5f, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x3e, 0x3e, 0x33, 0x29, 0x20,
+  0x2b, 0x20, 0x73, 0x29, 0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x20, 0x70, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78, 0x65, 0x6c,
+  0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x70, 0x61, 0x63, 0x6b, 0x2c, 0x20,
+  0x69, 0x29, 0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x2b, 0x2b, 0x3b,
+  0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6a, 0x20, 0x3d, 0x20, 0x30,
+  0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x6a, 0x3d, 0x30,
+  0x3b, 0x6a, 0x3c, 0x36, 0x34, 0x3b, 0x6a, 0x2b, 0x2b, 0x29, 0x20, 0x62,
+  0x5b, 0x6a, 0x5d, 0x3d, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x6a, 0x3d, 0x30,
+  0x3b, 0x0a, 0x20, 0x20, 0x62, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x69,
+  0x6e, 0x74, 0x28, 0x70, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x70, 0x20, 0x26,
+  0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x30, 0x78, 0x30, 0x38, 0x30, 0x30,
+  0x29, 0x29, 0x20, 0x3d, 0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x30,
+  0x78, 0x30, 0x38, 0x30, 0x30, 0x29, 0x20, 0x3f, 0x20, 0x75, 0x69, 0x6e,
+  0x74, 0x28, 0x7e, 0x30, 0x78, 0x66, 0x66, 0x66, 0x29, 0x20, 0x3a, 0x20,
+  0x75, 0x69, 0x6e, 0x74, 0x28, 0x30, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x69, 0x6e, 0x74, 0x20, 0x6c, 0x65, 0x6e, 0x3b, 0x0a, 0x20, 0x20,
+  0x77, 0x68, 0x69, 0x6c, 0x65, 0x20, 0x28, 0x6a, 0x20, 0x3c, 0x20, 0x36,
+  0x33, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x70, 0x20, 0x3d,
+  0x20, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28,
+  0x70, 0x61, 0x63, 0x6b, 0x2c, 0x20, 0x69, 0x29, 0x2e, 0x72, 0x3b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x69, 0x2b, 0x2b, 0x3b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x70, 0x20, 0x3d, 0x3d, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x28, 0x30, 0x29, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x20, 0x62, 0x72, 0x65, 0x61, 0x6b, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x6c, 0x65, 0x6e, 0x20,
+  0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28, 0x28, 0x70, 0x20, 0x3e, 0x3e, 0x20,
+  0x31, 0x32, 0x29, 0x20, 0x26, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x30,
+  0x78, 0x66, 0x29, 0x29, 0x20, 0x2b, 0x20, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x70, 0x20, 0x26, 0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28,
+  0x30, 0x78, 0x66, 0x66, 0x66, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x69, 0x6e, 0x74, 0x20, 0x63, 0x20, 0x3d, 0x20, 0x69, 0x6e, 0x74, 0x28,
+  0x70, 0x20, 0x7c, 0x20, 0x28, 0x28, 0x70, 0x20, 0x26, 0x20, 0x75, 0x69,
+  0x6e, 0x74, 0x28, 0x30, 0x78, 0x30, 0x38, 0x30, 0x30, 0x29, 0x29, 0x20,
+  0x3d, 0x3d, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x30, 0x78, 0x30, 0x38,
+  0x30, 0x30, 0x29, 0x20, 0x3f, 0x20, 0x75, 0x69, 0x6e, 0x74, 0x28, 0x7e,
+  0x30, 0x78, 0x66, 0x66, 0x66, 0x29, 0x20, 0x3a, 0x20, 0x75, 0x69, 0x6e,
+  0x74, 0x28, 0x30, 0x29, 0x29, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x6a, 0x20, 0x2b, 0x3d, 0x20, 0x6c, 0x65, 0x6e, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x62, 0x5b, 0x44, 0x45, 0x5f, 0x5a, 0x49, 0x47, 0x5f, 0x5a,
+  0x41, 0x47, 0x5b, 0x6a, 0x5d, 0x5d, 0x20, 0x3d, 0x20, 0x63, 0x3b, 0x0a,
+  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x6a, 0x20, 0x3d, 0x20, 0x28, 0x28,
+  0x74, 0x20, 0x26, 0x20, 0x30, 0x78, 0x37, 0x29, 0x20, 0x3c, 0x3c, 0x20,
+  0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6f, 0x20,
+  0x3d, 0x20, 0x30, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x76,
+  0x3e, 0x75, 0x5f, 0x63, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x20,
+  0x6f, 0x2b, 0x3d, 0x36, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x76, 0x3e, 0x75, 0x5f, 0x63, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65,
+  0x2b, 0x76, 0x5f, 0x63, 0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x29, 0x20,
+  0x6f, 0x2b, 0x3d, 0x36, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f,
+  0x61, 0x74, 0x20, 0x78, 0x5b, 0x38, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x66,
+  0x6c, 0x6f, 0x61, 0x74, 0x20, 0x79, 0x5b, 0x38, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b,
+  0x20, 0x69, 0x20, 0x3c, 0x20, 0x38, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74,
+  0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x20, 0x3d, 0x20, 0x74, 0x65, 0x78,
+  0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x71, 0x75, 0x61, 0x6e,
+  0x74, 0x2c, 0x20, 0x6f, 0x20, 0x2b, 0x20, 0x6a, 0x20, 0x2b, 0x20, 0x69,
+  0x29, 0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x79, 0x5b, 0x69,
+  0x5d, 0x3d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x2a, 0x62, 0x5b, 0x6a, 0x20,
+  0x2b, 0x20, 0x69, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x67, 0x6c, 0x6a, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x63,
+  0x74, 0x38, 0x28, 0x78, 0x2c, 0x20, 0x79, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x68, 0x5f, 0x6c, 0x6f, 0x77, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x78,
+  0x5b, 0x30, 0x5d, 0x2c, 0x78, 0x5b, 0x31, 0x5d, 0x2c, 0x78, 0x5b, 0x32,
+  0x5d, 0x2c, 0x78, 0x5b, 0x33, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68,
+  0x5f, 0x68, 0x69, 0x67, 0x68, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x78,
+  0x5b, 0x34, 0x5d, 0x2c, 0x78, 0x5b, 0x35, 0x5d, 0x2c, 0x78, 0x5b, 0x36,
+  0x5d, 0x2c, 0x78, 0x5b, 0x37, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x2f,
+  0x2a, 0x69, 0x66, 0x20, 0x28, 0x74, 0x3e, 0x2d, 0x31, 0x29, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x5f, 0x6c, 0x6f, 0x77, 0x3d, 0x76,
+  0x65, 0x63, 0x34, 0x28, 0x70, 0x2c, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x29,
+  0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x5f, 0x68, 0x69, 0x67, 0x68,
+  0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x74, 0x2c, 0x31, 0x2c, 0x31, 0x2c,
+  0x31, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x5f, 0x6c, 0x6f,
+  0x77, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x62, 0x5b, 0x6a, 0x2b, 0x30,
+  0x5d, 0x2c, 0x62, 0x5b, 0x6a, 0x2b, 0x31, 0x5d, 0x2c, 0x62, 0x5b, 0x6a,
+  0x2b, 0x32, 0x5d, 0x2c, 0x62, 0x5b, 0x6a, 0x2b, 0x33, 0x5d, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x20, 0x20, 0x68, 0x5f, 0x68, 0x69, 0x67, 0x68, 0x3d,
+  0x76, 0x65, 0x63, 0x34, 0x28, 0x62, 0x5b, 0x6a, 0x2b, 0x34, 0x5d, 0x2c,
+  0x62, 0x5b, 0x6a, 0x2b, 0x35, 0x5d, 0x2c, 0x62, 0x5b, 0x6a, 0x2b, 0x36,
+  0x5d, 0x2c, 0x62, 0x5b, 0x6a, 0x2b, 0x37, 0x5d, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x7d, 0x2a, 0x2f, 0x0a, 0x20, 0x7d, 0x0a
+, 0x00 };
+static const char HORZ_QUANT_GREY_FS[] = {
+  0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34, 0x30,
+  0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x67, 0x6c, 0x6a, 0x5f, 0x72,
+  0x65, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x63, 0x74, 0x38, 0x28, 0x6f, 0x75,
+  0x74, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x78, 0x5b, 0x38, 0x5d,
+  0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x66, 0x6c, 0x6f, 0x61,
+  0x74, 0x20, 0x79, 0x5b, 0x38, 0x5d, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x30, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x32, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x30, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x38, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x30, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x75, 0x34, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x31, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x32, 0x5d, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x33, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x34,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d, 0x20, 0x79, 0x5b,
+  0x35, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x33, 0x20, 0x3d, 0x20, 0x79,
+  0x5b, 0x36, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x37, 0x20, 0x3d, 0x20,
+  0x79, 0x5b, 0x37, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x45,
+  0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x73, 0x63, 0x61, 0x6c,
+  0x65, 0x64, 0x20, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x34,
+  0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x54, 0x79, 0x70, 0x65, 0x2d,
+  0x49, 0x49, 0x20, 0x44, 0x43, 0x54, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20,
+  0x75, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2b, 0x20, 0x74, 0x31,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20,
+  0x2d, 0x20, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x33, 0x20, 0x3d,
+  0x20, 0x74, 0x32, 0x20, 0x2b, 0x20, 0x74, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x32, 0x20, 0x2d, 0x20, 0x74,
+  0x33, 0x29, 0x2a, 0x31, 0x2e, 0x34, 0x31, 0x34, 0x32, 0x31, 0x33, 0x35,
+  0x36, 0x32, 0x33, 0x37, 0x33, 0x30, 0x39, 0x35, 0x30, 0x34, 0x38, 0x38,
+  0x30, 0x31, 0x36, 0x38, 0x38, 0x37, 0x32, 0x34, 0x32, 0x30, 0x39, 0x37,
+  0x20, 0x2d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x30, 0x20,
+  0x3d, 0x20, 0x75, 0x30, 0x20, 0x2b, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20,
+  0x20, 0x74, 0x33, 0x20, 0x3d, 0x20, 0x75, 0x30, 0x20, 0x2d, 0x20, 0x75,
+  0x33, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x75, 0x31,
+  0x20, 0x2b, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x32, 0x20,
+  0x3d, 0x20, 0x75, 0x31, 0x20, 0x2d, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20,
+  0x20, 0x2f, 0x2a, 0x20, 0x45, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64,
+  0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x76, 0x65,
+  0x72, 0x73, 0x65, 0x20, 0x34, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20,
+  0x54, 0x79, 0x70, 0x65, 0x2d, 0x49, 0x56, 0x20, 0x44, 0x53, 0x54, 0x20,
+  0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x74, 0x35, 0x20, 0x3d, 0x20, 0x75, 0x35,
+  0x20, 0x2b, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x36, 0x20,
+  0x3d, 0x20, 0x75, 0x35, 0x20, 0x2d, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20,
+  0x20, 0x74, 0x37, 0x20, 0x3d, 0x20, 0x75, 0x34, 0x20, 0x2b, 0x20, 0x75,
+  0x37, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x34, 0x20, 0x3d, 0x20, 0x75, 0x34,
+  0x20, 0x2d, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x37, 0x20,
+  0x3d, 0x20, 0x74, 0x37, 0x20, 0x2b, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20,
+  0x20, 0x75, 0x35, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x37, 0x20, 0x2d, 0x20,
+  0x74, 0x35, 0x29, 0x2a, 0x31, 0x2e, 0x34, 0x31, 0x34, 0x32, 0x31, 0x33,
+  0x35, 0x36, 0x32, 0x33, 0x37, 0x33, 0x30, 0x39, 0x35, 0x30, 0x34, 0x38,
+  0x38, 0x30, 0x31, 0x36, 0x38, 0x38, 0x37, 0x32, 0x34, 0x32, 0x30, 0x39,
+  0x37, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x38, 0x20, 0x3d, 0x20, 0x28, 0x74,
+  0x34, 0x20, 0x2b, 0x20, 0x74, 0x36, 0x29, 0x2a, 0x31, 0x2e, 0x38, 0x34,
+  0x37, 0x37, 0x35, 0x39, 0x30, 0x36, 0x35, 0x30, 0x32, 0x32, 0x35, 0x37,
+  0x33, 0x35, 0x31, 0x32, 0x32, 0x35, 0x36, 0x33, 0x36, 0x36, 0x33, 0x37,
+  0x38, 0x37, 0x39, 0x33, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x34, 0x20,
+  0x3d, 0x20, 0x75, 0x38, 0x20, 0x2d, 0x20, 0x74, 0x34, 0x2a, 0x31, 0x2e,
+  0x30, 0x38, 0x32, 0x33, 0x39, 0x32, 0x32, 0x30, 0x30, 0x32, 0x39, 0x32,
+  0x33, 0x39, 0x33, 0x39, 0x36, 0x38, 0x37, 0x39, 0x39, 0x34, 0x34, 0x36,
+  0x34, 0x31, 0x30, 0x37, 0x33, 0x32, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x75,
+  0x36, 0x20, 0x3d, 0x20, 0x75, 0x38, 0x20, 0x2d, 0x20, 0x74, 0x36, 0x2a,
+  0x32, 0x2e, 0x36, 0x31, 0x33, 0x31, 0x32, 0x35, 0x39, 0x32, 0x39, 0x37,
+  0x35, 0x32, 0x37, 0x35, 0x33, 0x30, 0x35, 0x35, 0x37, 0x31, 0x33, 0x32,
+  0x38, 0x36, 0x33, 0x34, 0x36, 0x38, 0x35, 0x34, 0x34, 0x3b, 0x0a, 0x20,
+  0x20, 0x74, 0x37, 0x20, 0x3d, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x37, 0x20, 0x2d, 0x20, 0x75, 0x36,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x35, 0x20, 0x3d, 0x20, 0x74, 0x36, 0x20,
+  0x2b, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x34, 0x20, 0x3d,
+  0x20, 0x74, 0x35, 0x20, 0x2d, 0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x2f, 0x2a, 0x20, 0x42, 0x75, 0x74, 0x74, 0x65, 0x72, 0x66, 0x6c, 0x69,
+  0x65, 0x73, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x75, 0x30, 0x20, 0x3d,
+  0x20, 0x74, 0x30, 0x20, 0x2b, 0x20, 0x74, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x37, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2d, 0x20, 0x74, 0x37,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x31, 0x20,
+  0x2b, 0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x31, 0x20, 0x3d,
+  0x20, 0x74, 0x31, 0x20, 0x2d, 0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x32, 0x20, 0x3d, 0x20, 0x74, 0x32, 0x20, 0x2b, 0x20, 0x74, 0x35,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d, 0x20, 0x74, 0x32, 0x20,
+  0x2d, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x34, 0x20, 0x3d,
+  0x20, 0x74, 0x33, 0x20, 0x2b, 0x20, 0x74, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x33, 0x20, 0x3d, 0x20, 0x74, 0x33, 0x20, 0x2d, 0x20, 0x74, 0x34,
+  0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x75,
+  0x30, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20,
+  0x75, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x32, 0x5d, 0x20, 0x3d,
+  0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x33, 0x5d, 0x20,
+  0x3d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x34, 0x5d,
+  0x20, 0x3d, 0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x35,
+  0x5d, 0x20, 0x3d, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b,
+  0x36, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x78,
+  0x5b, 0x37, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x65, 0x78,
+  0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x0a, 0x6f, 0x75, 0x74,
+  0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x68, 0x5f, 0x6c, 0x6f, 0x77, 0x3b,
+  0x0a, 0x6f, 0x75, 0x74, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x68, 0x5f,
+  0x68, 0x69, 0x67, 0x68, 0x3b, 0x0a, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f,
+  0x72, 0x6d, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x42, 0x75,
+  0x66, 0x66, 0x65, 0x72, 0x20, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x3b, 0x0a,
+  0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x73, 0x61, 0x6d,
+  0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x74, 0x65, 0x78, 0x3b, 0x0a,
+  0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x3d, 0x69,
+  0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64,
+  0x2e, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f,
+  0x72, 0x64, 0x2e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x6a, 0x3d, 0x28, 0x28, 0x74, 0x26, 0x30, 0x78, 0x37, 0x29, 0x3c,
+  0x3c, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x75,
+  0x3d, 0x28, 0x73, 0x3c, 0x3c, 0x36, 0x29, 0x2b, 0x6a, 0x3b, 0x0a, 0x20,
+  0x20, 0x69, 0x6e, 0x74, 0x20, 0x76, 0x3d, 0x74, 0x3e, 0x3e, 0x33, 0x3b,
+  0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x78, 0x5b, 0x38, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x79, 0x5b, 0x38, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x3d, 0x30,
+  0x3b, 0x69, 0x3c, 0x38, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x73, 0x63,
+  0x61, 0x6c, 0x65, 0x3d, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74,
+  0x63, 0x68, 0x28, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x2c, 0x6a, 0x2b, 0x69,
+  0x29, 0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x79, 0x5b, 0x69,
+  0x5d, 0x3d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x2a, 0x74, 0x65, 0x78, 0x65,
+  0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x74, 0x65, 0x78, 0x2c, 0x69,
+  0x76, 0x65, 0x63, 0x32, 0x28, 0x75, 0x2b, 0x69, 0x2c, 0x76, 0x29, 0x2c,
+  0x30, 0x29, 0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x67, 0x6c, 0x6a, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x63,
+  0x74, 0x38, 0x28, 0x78, 0x2c, 0x20, 0x79, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x68, 0x5f, 0x6c, 0x6f, 0x77, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x78,
+  0x5b, 0x30, 0x5d, 0x2c, 0x78, 0x5b, 0x31, 0x5d, 0x2c, 0x78, 0x5b, 0x32,
+  0x5d, 0x2c, 0x78, 0x5b, 0x33, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68,
+  0x5f, 0x68, 0x69, 0x67, 0x68, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x78,
+  0x5b, 0x34, 0x5d, 0x2c, 0x78, 0x5b, 0x35, 0x5d, 0x2c, 0x78, 0x5b, 0x36,
+  0x5d, 0x2c, 0x78, 0x5b, 0x37, 0x5d, 0x29, 0x3b, 0x0a, 0x7d, 0x0a
+, 0x00 };
+static const char HORZ_QUANT_YUV_FS[] = {
+  0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34, 0x30,
+  0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x67, 0x6c, 0x6a, 0x5f, 0x72,
+  0x65, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x63, 0x74, 0x38, 0x28, 0x6f, 0x75,
+  0x74, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x78, 0x5b, 0x38, 0x5d,
+  0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x66, 0x6c, 0x6f, 0x61,
+  0x74, 0x20, 0x79, 0x5b, 0x38, 0x5d, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x30, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x32, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x30, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x38, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x30, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x75, 0x34, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x31, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x32, 0x5d, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x33, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x34,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d, 0x20, 0x79, 0x5b,
+  0x35, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x33, 0x20, 0x3d, 0x20, 0x79,
+  0x5b, 0x36, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x37, 0x20, 0x3d, 0x20,
+  0x79, 0x5b, 0x37, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x45,
+  0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x73, 0x63, 0x61, 0x6c,
+  0x65, 0x64, 0x20, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x34,
+  0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x54, 0x79, 0x70, 0x65, 0x2d,
+  0x49, 0x49, 0x20, 0x44, 0x43, 0x54, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20,
+  0x75, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2b, 0x20, 0x74, 0x31,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20,
+  0x2d, 0x20, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x33, 0x20, 0x3d,
+  0x20, 0x74, 0x32, 0x20, 0x2b, 0x20, 0x74, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x32, 0x20, 0x2d, 0x20, 0x74,
+  0x33, 0x29, 0x2a, 0x31, 0x2e, 0x34, 0x31, 0x34, 0x32, 0x31, 0x33, 0x35,
+  0x36, 0x32, 0x33, 0x37, 0x33, 0x30, 0x39, 0x35, 0x30, 0x34, 0x38, 0x38,
+  0x30, 0x31, 0x36, 0x38, 0x38, 0x37, 0x32, 0x34, 0x32, 0x30, 0x39, 0x37,
+  0x20, 0x2d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x30, 0x20,
+  0x3d, 0x20, 0x75, 0x30, 0x20, 0x2b, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20,
+  0x20, 0x74, 0x33, 0x20, 0x3d, 0x20, 0x75, 0x30, 0x20, 0x2d, 0x20, 0x75,
+  0x33, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x75, 0x31,
+  0x20, 0x2b, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x32, 0x20,
+  0x3d, 0x20, 0x75, 0x31, 0x20, 0x2d, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20,
+  0x20, 0x2f, 0x2a, 0x20, 0x45, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64,
+  0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x76, 0x65,
+  0x72, 0x73, 0x65, 0x20, 0x34, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20,
+  0x54, 0x79, 0x70, 0x65, 0x2d, 0x49, 0x56, 0x20, 0x44, 0x53, 0x54, 0x20,
+  0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x74, 0x35, 0x20, 0x3d, 0x20, 0x75, 0x35,
+  0x20, 0x2b, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x36, 0x20,
+  0x3d, 0x20, 0x75, 0x35, 0x20, 0x2d, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20,
+  0x20, 0x74, 0x37, 0x20, 0x3d, 0x20, 0x75, 0x34, 0x20, 0x2b, 0x20, 0x75,
+  0x37, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x34, 0x20, 0x3d, 0x20, 0x75, 0x34,
+  0x20, 0x2d, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x37, 0x20,
+  0x3d, 0x20, 0x74, 0x37, 0x20, 0x2b, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20,
+  0x20, 0x75, 0x35, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x37, 0x20, 0x2d, 0x20,
+  0x74, 0x35, 0x29, 0x2a, 0x31, 0x2e, 0x34, 0x31, 0x34, 0x32, 0x31, 0x33,
+  0x35, 0x36, 0x32, 0x33, 0x37, 0x33, 0x30, 0x39, 0x35, 0x30, 0x34, 0x38,
+  0x38, 0x30, 0x31, 0x36, 0x38, 0x38, 0x37, 0x32, 0x34, 0x32, 0x30, 0x39,
+  0x37, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x38, 0x20, 0x3d, 0x20, 0x28, 0x74,
+  0x34, 0x20, 0x2b, 0x20, 0x74, 0x36, 0x29, 0x2a, 0x31, 0x2e, 0x38, 0x34,
+  0x37, 0x37, 0x35, 0x39, 0x30, 0x36, 0x35, 0x30, 0x32, 0x32, 0x35, 0x37,
+  0x33, 0x35, 0x31, 0x32, 0x32, 0x35, 0x36, 0x33, 0x36, 0x36, 0x33, 0x37,
+  0x38, 0x37, 0x39, 0x33, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x34, 0x20,
+  0x3d, 0x20, 0x75, 0x38, 0x20, 0x2d, 0x20, 0x74, 0x34, 0x2a, 0x31, 0x2e,
+  0x30, 0x38, 0x32, 0x33, 0x39, 0x32, 0x32, 0x30, 0x30, 0x32, 0x39, 0x32,
+  0x33, 0x39, 0x33, 0x39, 0x36, 0x38, 0x37, 0x39, 0x39, 0x34, 0x34, 0x36,
+  0x34, 0x31, 0x30, 0x37, 0x33, 0x32, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x75,
+  0x36, 0x20, 0x3d, 0x20, 0x75, 0x38, 0x20, 0x2d, 0x20, 0x74, 0x36, 0x2a,
+  0x32, 0x2e, 0x36, 0x31, 0x33, 0x31, 0x32, 0x35, 0x39, 0x32, 0x39, 0x37,
+  0x35, 0x32, 0x37, 0x35, 0x33, 0x30, 0x35, 0x35, 0x37, 0x31, 0x33, 0x32,
+  0x38, 0x36, 0x33, 0x34, 0x36, 0x38, 0x35, 0x34, 0x34, 0x3b, 0x0a, 0x20,
+  0x20, 0x74, 0x37, 0x20, 0x3d, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x37, 0x20, 0x2d, 0x20, 0x75, 0x36,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x35, 0x20, 0x3d, 0x20, 0x74, 0x36, 0x20,
+  0x2b, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x34, 0x20, 0x3d,
+  0x20, 0x74, 0x35, 0x20, 0x2d, 0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x2f, 0x2a, 0x20, 0x42, 0x75, 0x74, 0x74, 0x65, 0x72, 0x66, 0x6c, 0x69,
+  0x65, 0x73, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x75, 0x30, 0x20, 0x3d,
+  0x20, 0x74, 0x30, 0x20, 0x2b, 0x20, 0x74, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x37, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2d, 0x20, 0x74, 0x37,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x31, 0x20,
+  0x2b, 0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x31, 0x20, 0x3d,
+  0x20, 0x74, 0x31, 0x20, 0x2d, 0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x32, 0x20, 0x3d, 0x20, 0x74, 0x32, 0x20, 0x2b, 0x20, 0x74, 0x35,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d, 0x20, 0x74, 0x32, 0x20,
+  0x2d, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x34, 0x20, 0x3d,
+  0x20, 0x74, 0x33, 0x20, 0x2b, 0x20, 0x74, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x33, 0x20, 0x3d, 0x20, 0x74, 0x33, 0x20, 0x2d, 0x20, 0x74, 0x34,
+  0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x75,
+  0x30, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20,
+  0x75, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x32, 0x5d, 0x20, 0x3d,
+  0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x33, 0x5d, 0x20,
+  0x3d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x34, 0x5d,
+  0x20, 0x3d, 0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x35,
+  0x5d, 0x20, 0x3d, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b,
+  0x36, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x78,
+  0x5b, 0x37, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x65, 0x78,
+  0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x0a, 0x6f, 0x75, 0x74,
+  0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x68, 0x5f, 0x6c, 0x6f, 0x77, 0x3b,
+  0x0a, 0x6f, 0x75, 0x74, 0x20, 0x76, 0x65, 0x63, 0x34, 0x20, 0x68, 0x5f,
+  0x68, 0x69, 0x67, 0x68, 0x3b, 0x0a, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f,
+  0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x75, 0x5f, 0x63, 0x73, 0x74,
+  0x72, 0x69, 0x64, 0x65, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72,
+  0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x76, 0x5f, 0x63, 0x73, 0x74, 0x72,
+  0x69, 0x64, 0x65, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d,
+  0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x42, 0x75, 0x66, 0x66,
+  0x65, 0x72, 0x20, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x3b, 0x0a, 0x75, 0x6e,
+  0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x73, 0x61, 0x6d, 0x70, 0x6c,
+  0x65, 0x72, 0x32, 0x44, 0x20, 0x74, 0x65, 0x78, 0x3b, 0x0a, 0x0a, 0x76,
+  0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29, 0x20, 0x7b,
+  0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x3d, 0x69, 0x6e, 0x74,
+  0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x73,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x3d, 0x69,
+  0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64,
+  0x2e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6a,
+  0x3d, 0x28, 0x28, 0x74, 0x26, 0x30, 0x78, 0x37, 0x29, 0x3c, 0x3c, 0x33,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x75, 0x3d, 0x28,
+  0x73, 0x3c, 0x3c, 0x36, 0x29, 0x2b, 0x6a, 0x3b, 0x0a, 0x20, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x76, 0x3d, 0x74, 0x3e, 0x3e, 0x33, 0x3b, 0x0a, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x76, 0x3e, 0x75, 0x5f, 0x63, 0x73, 0x74,
+  0x72, 0x69, 0x64, 0x65, 0x29, 0x20, 0x6a, 0x2b, 0x3d, 0x36, 0x34, 0x3b,
+  0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x76, 0x3e, 0x75, 0x5f, 0x63,
+  0x73, 0x74, 0x72, 0x69, 0x64, 0x65, 0x2b, 0x76, 0x5f, 0x63, 0x73, 0x74,
+  0x72, 0x69, 0x64, 0x65, 0x29, 0x20, 0x6a, 0x2b, 0x3d, 0x36, 0x34, 0x3b,
+  0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x78, 0x5b, 0x38, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x79, 0x5b, 0x38, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69, 0x3d, 0x30,
+  0x3b, 0x69, 0x3c, 0x38, 0x3b, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a,
+  0x20, 0x20, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x73, 0x63,
+  0x61, 0x6c, 0x65, 0x3d, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74,
+  0x63, 0x68, 0x28, 0x71, 0x75, 0x61, 0x6e, 0x74, 0x2c, 0x6a, 0x2b, 0x69,
+  0x29, 0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x79, 0x5b, 0x69,
+  0x5d, 0x3d, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x2a, 0x74, 0x65, 0x78, 0x65,
+  0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x74, 0x65, 0x78, 0x2c, 0x69,
+  0x76, 0x65, 0x63, 0x32, 0x28, 0x75, 0x2b, 0x69, 0x2c, 0x76, 0x29, 0x2c,
+  0x30, 0x29, 0x2e, 0x72, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x67, 0x6c, 0x6a, 0x5f, 0x72, 0x65, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x63,
+  0x74, 0x38, 0x28, 0x78, 0x2c, 0x20, 0x79, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x68, 0x5f, 0x6c, 0x6f, 0x77, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x78,
+  0x5b, 0x30, 0x5d, 0x2c, 0x78, 0x5b, 0x31, 0x5d, 0x2c, 0x78, 0x5b, 0x32,
+  0x5d, 0x2c, 0x78, 0x5b, 0x33, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x68,
+  0x5f, 0x68, 0x69, 0x67, 0x68, 0x3d, 0x76, 0x65, 0x63, 0x34, 0x28, 0x78,
+  0x5b, 0x34, 0x5d, 0x2c, 0x78, 0x5b, 0x35, 0x5d, 0x2c, 0x78, 0x5b, 0x36,
+  0x5d, 0x2c, 0x78, 0x5b, 0x37, 0x5d, 0x29, 0x3b, 0x0a, 0x7d, 0x0a
+, 0x00 };
+static const char RGB_FS[] = {
+  0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34, 0x30,
+  0x0a, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x65, 0x78,
+  0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x6f, 0x75, 0x74, 0x20,
+  0x76, 0x65, 0x63, 0x33, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3b, 0x0a,
+  0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d,
+  0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x72, 0x67, 0x62, 0x5f, 0x74,
+  0x65, 0x78, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69,
+  0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x73, 0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f,
+  0x6f, 0x72, 0x64, 0x2e, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e,
+  0x74, 0x20, 0x74, 0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f,
+  0x63, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x76, 0x65, 0x63, 0x33, 0x28, 0x74,
+  0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x72, 0x67,
+  0x62, 0x5f, 0x74, 0x65, 0x78, 0x2c, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28,
+  0x73, 0x2c, 0x74, 0x29, 0x2c, 0x30, 0x29, 0x2e, 0x72, 0x67, 0x62, 0x29,
+  0x2f, 0x32, 0x35, 0x35, 0x2e, 0x30, 0x3b, 0x0a, 0x7d, 0x0a
+, 0x00 };
+static const char TEX_VS[] = {
+  0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34, 0x30,
+  0x0a, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x69, 0x6e, 0x5f,
+  0x70, 0x6f, 0x73, 0x3b, 0x0a, 0x69, 0x6e, 0x20, 0x69, 0x76, 0x65, 0x63,
+  0x32, 0x20, 0x69, 0x6e, 0x5f, 0x74, 0x65, 0x78, 0x3b, 0x0a, 0x6f, 0x75,
+  0x74, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x65, 0x78, 0x5f, 0x63,
+  0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d,
+  0x61, 0x69, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x67, 0x6c,
+  0x5f, 0x50, 0x6f, 0x73, 0x69, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x3d, 0x20,
+  0x76, 0x65, 0x63, 0x34, 0x28, 0x69, 0x6e, 0x5f, 0x70, 0x6f, 0x73, 0x2e,
+  0x78, 0x2c, 0x20, 0x69, 0x6e, 0x5f, 0x70, 0x6f, 0x73, 0x2e, 0x79, 0x2c,
+  0x20, 0x69, 0x6e, 0x5f, 0x70, 0x6f, 0x73, 0x2e, 0x7a, 0x2c, 0x20, 0x31,
+  0x2e, 0x30, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x65, 0x78, 0x5f, 0x63,
+  0x6f, 0x6f, 0x72, 0x64, 0x20, 0x3d, 0x20, 0x76, 0x65, 0x63, 0x32, 0x28,
+  0x69, 0x6e, 0x5f, 0x74, 0x65, 0x78, 0x29, 0x3b, 0x0a, 0x7d, 0x0a
+, 0x00 };
+static const char UNGREY_FS[] = {
+  0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34, 0x30,
+  0x0a, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x65, 0x78,
+  0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x6f, 0x75, 0x74, 0x20,
+  0x76, 0x65, 0x63, 0x33, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3b, 0x0a,
+  0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x73, 0x61, 0x6d,
+  0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x6c, 0x6f, 0x77, 0x3b, 0x0a,
+  0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x73, 0x61, 0x6d,
+  0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x68, 0x69, 0x67, 0x68, 0x3b,
+  0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x3d, 0x69,
+  0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64,
+  0x2e, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f,
+  0x72, 0x64, 0x2e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x76, 0x3d, 0x74, 0x3e, 0x3e, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x6a, 0x3d, 0x74, 0x25, 0x38, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x79, 0x3b, 0x0a, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x6a, 0x3c, 0x34, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x79, 0x3d, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x74, 0x65,
+  0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x6c, 0x6f, 0x77,
+  0x2c, 0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x73, 0x2c, 0x76, 0x29,
+  0x2c, 0x30, 0x29, 0x5b, 0x6a, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x79, 0x3d, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x74, 0x65,
+  0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x68, 0x69, 0x67,
+  0x68, 0x2c, 0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x73, 0x2c, 0x76,
+  0x29, 0x2c, 0x30, 0x29, 0x5b, 0x6a, 0x2d, 0x34, 0x5d, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d,
+  0x76, 0x65, 0x63, 0x33, 0x28, 0x79, 0x2c, 0x79, 0x2c, 0x79, 0x29, 0x2f,
+  0x32, 0x35, 0x35, 0x2e, 0x30, 0x3b, 0x0a, 0x7d, 0x0a
+, 0x00 };
+static const char UNYUV_FS[] = {
+  0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34, 0x30,
+  0x0a, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x65, 0x78,
+  0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x6f, 0x75, 0x74, 0x20,
+  0x76, 0x65, 0x63, 0x33, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3b, 0x0a,
+  0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x79, 0x5f, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3b, 0x0a, 0x75, 0x6e, 0x69,
+  0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x79, 0x5f, 0x68,
+  0x65, 0x69, 0x67, 0x68, 0x74, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f,
+  0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x75, 0x5f, 0x78, 0x64, 0x65,
+  0x63, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x75, 0x5f, 0x79, 0x64, 0x65, 0x63, 0x3b, 0x0a, 0x75,
+  0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x76,
+  0x5f, 0x78, 0x64, 0x65, 0x63, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f,
+  0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x76, 0x5f, 0x79, 0x64, 0x65,
+  0x63, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69,
+  0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x6c, 0x6f,
+  0x77, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69,
+  0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x68, 0x69,
+  0x67, 0x68, 0x3b, 0x0a, 0x6d, 0x61, 0x74, 0x33, 0x20, 0x79, 0x75, 0x76,
+  0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x74, 0x33,
+  0x28, 0x0a, 0x20, 0x20, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20,
+  0x31, 0x2e, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x2e, 0x30,
+  0x2c, 0x0a, 0x20, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x2d,
+  0x30, 0x2e, 0x33, 0x34, 0x34, 0x31, 0x34, 0x2c, 0x20, 0x31, 0x2e, 0x37,
+  0x37, 0x32, 0x2c, 0x0a, 0x20, 0x20, 0x31, 0x2e, 0x34, 0x30, 0x32, 0x2c,
+  0x20, 0x2d, 0x30, 0x2e, 0x37, 0x31, 0x34, 0x31, 0x34, 0x2c, 0x20, 0x30,
+  0x2e, 0x30, 0x0a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d,
+  0x61, 0x69, 0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x69, 0x6e,
+  0x74, 0x20, 0x73, 0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f,
+  0x63, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x69, 0x6e, 0x74, 0x20, 0x74, 0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65,
+  0x78, 0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x74, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x79, 0x3b, 0x0a, 0x20,
+  0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x76, 0x3b, 0x0a, 0x20, 0x20, 0x69,
+  0x66, 0x20, 0x28, 0x28, 0x74, 0x26, 0x30, 0x78, 0x34, 0x29, 0x3d, 0x3d,
+  0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x79, 0x3d, 0x66,
+  0x6c, 0x6f, 0x61, 0x74, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65,
+  0x74, 0x63, 0x68, 0x28, 0x6c, 0x6f, 0x77, 0x2c, 0x20, 0x69, 0x76, 0x65,
+  0x63, 0x32, 0x28, 0x73, 0x2c, 0x74, 0x3e, 0x3e, 0x33, 0x29, 0x2c, 0x30,
+  0x29, 0x5b, 0x74, 0x26, 0x33, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d,
+  0x0a, 0x20, 0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x79, 0x3d, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x74, 0x65,
+  0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x68, 0x69, 0x67,
+  0x68, 0x2c, 0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x73, 0x2c, 0x74,
+  0x3e, 0x3e, 0x33, 0x29, 0x2c, 0x30, 0x29, 0x5b, 0x74, 0x26, 0x33, 0x5d,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x62, 0x79, 0x5f, 0x75, 0x3d, 0x74, 0x3e, 0x3e, 0x28, 0x75, 0x5f,
+  0x79, 0x64, 0x65, 0x63, 0x2b, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x73, 0x5f, 0x75, 0x3d, 0x28, 0x79, 0x5f, 0x77, 0x69,
+  0x64, 0x74, 0x68, 0x3e, 0x3e, 0x75, 0x5f, 0x78, 0x64, 0x65, 0x63, 0x29,
+  0x2a, 0x28, 0x62, 0x79, 0x5f, 0x75, 0x26, 0x28, 0x28, 0x31, 0x3c, 0x3c,
+  0x75, 0x5f, 0x78, 0x64, 0x65, 0x63, 0x29, 0x2d, 0x31, 0x29, 0x29, 0x2b,
+  0x28, 0x73, 0x3e, 0x3e, 0x75, 0x5f, 0x78, 0x64, 0x65, 0x63, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x5f, 0x75, 0x3d, 0x79,
+  0x5f, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2b, 0x28, 0x28, 0x62, 0x79,
+  0x5f, 0x75, 0x3e, 0x3e, 0x75, 0x5f, 0x78, 0x64, 0x65, 0x63, 0x29, 0x3c,
+  0x3c, 0x33, 0x29, 0x2b, 0x28, 0x28, 0x74, 0x3e, 0x3e, 0x75, 0x5f, 0x79,
+  0x64, 0x65, 0x63, 0x29, 0x26, 0x30, 0x78, 0x37, 0x29, 0x3b, 0x0a, 0x20,
+  0x20, 0x69, 0x66, 0x20, 0x28, 0x28, 0x74, 0x5f, 0x75, 0x26, 0x30, 0x78,
+  0x34, 0x29, 0x3d, 0x3d, 0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20,
+  0x20, 0x75, 0x3d, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x74, 0x65, 0x78,
+  0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x6c, 0x6f, 0x77, 0x2c,
+  0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x73, 0x5f, 0x75, 0x2c, 0x74,
+  0x5f, 0x75, 0x3e, 0x3e, 0x33, 0x29, 0x2c, 0x30, 0x29, 0x5b, 0x74, 0x5f,
+  0x75, 0x26, 0x33, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x65, 0x6c, 0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x75, 0x3d, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28, 0x74, 0x65, 0x78, 0x65,
+  0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x68, 0x69, 0x67, 0x68, 0x2c,
+  0x20, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x73, 0x5f, 0x75, 0x2c, 0x74,
+  0x5f, 0x75, 0x3e, 0x3e, 0x33, 0x29, 0x2c, 0x30, 0x29, 0x5b, 0x74, 0x5f,
+  0x75, 0x26, 0x33, 0x5d, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20,
+  0x20, 0x62, 0x79, 0x5f, 0x75, 0x3d, 0x28, 0x28, 0x79, 0x5f, 0x68, 0x65,
+  0x69, 0x67, 0x68, 0x74, 0x3e, 0x3e, 0x28, 0x75, 0x5f, 0x79, 0x64, 0x65,
+  0x63, 0x2b, 0x33, 0x29, 0x29, 0x2b, 0x28, 0x28, 0x31, 0x3c, 0x3c, 0x75,
+  0x5f, 0x78, 0x64, 0x65, 0x63, 0x29, 0x2d, 0x31, 0x29, 0x29, 0x3e, 0x3e,
+  0x75, 0x5f, 0x78, 0x64, 0x65, 0x63, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e,
+  0x74, 0x20, 0x62, 0x79, 0x5f, 0x76, 0x3d, 0x74, 0x3e, 0x3e, 0x28, 0x76,
+  0x5f, 0x79, 0x64, 0x65, 0x63, 0x2b, 0x33, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x69, 0x6e, 0x74, 0x20, 0x73, 0x5f, 0x76, 0x3d, 0x28, 0x79, 0x5f, 0x77,
+  0x69, 0x64, 0x74, 0x68, 0x3e, 0x3e, 0x76, 0x5f, 0x78, 0x64, 0x65, 0x63,
+  0x29, 0x2a, 0x28, 0x62, 0x79, 0x5f, 0x76, 0x26, 0x28, 0x28, 0x31, 0x3c,
+  0x3c, 0x76, 0x5f, 0x78, 0x64, 0x65, 0x63, 0x29, 0x2d, 0x31, 0x29, 0x29,
+  0x2b, 0x28, 0x73, 0x3e, 0x3e, 0x76, 0x5f, 0x78, 0x64, 0x65, 0x63, 0x29,
+  0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x74, 0x5f, 0x76, 0x3d,
+  0x79, 0x5f, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2b, 0x28, 0x28, 0x62,
+  0x79, 0x5f, 0x75, 0x2b, 0x28, 0x62, 0x79, 0x5f, 0x76, 0x3e, 0x3e, 0x76,
+  0x5f, 0x78, 0x64, 0x65, 0x63, 0x29, 0x29, 0x3c, 0x3c, 0x33, 0x29, 0x2b,
+  0x28, 0x28, 0x74, 0x3e, 0x3e, 0x76, 0x5f, 0x79, 0x64, 0x65, 0x63, 0x29,
+  0x26, 0x30, 0x78, 0x37, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x66, 0x20,
+  0x28, 0x28, 0x74, 0x5f, 0x76, 0x26, 0x30, 0x78, 0x34, 0x29, 0x3d, 0x3d,
+  0x30, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x3d, 0x66,
+  0x6c, 0x6f, 0x61, 0x74, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65,
+  0x74, 0x63, 0x68, 0x28, 0x6c, 0x6f, 0x77, 0x2c, 0x20, 0x69, 0x76, 0x65,
+  0x63, 0x32, 0x28, 0x73, 0x5f, 0x76, 0x2c, 0x74, 0x5f, 0x76, 0x3e, 0x3e,
+  0x33, 0x29, 0x2c, 0x30, 0x29, 0x5b, 0x74, 0x5f, 0x76, 0x26, 0x33, 0x5d,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x65, 0x6c, 0x73,
+  0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x76, 0x3d, 0x66, 0x6c,
+  0x6f, 0x61, 0x74, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74,
+  0x63, 0x68, 0x28, 0x68, 0x69, 0x67, 0x68, 0x2c, 0x20, 0x69, 0x76, 0x65,
+  0x63, 0x32, 0x28, 0x73, 0x5f, 0x76, 0x2c, 0x74, 0x5f, 0x76, 0x3e, 0x3e,
+  0x33, 0x29, 0x2c, 0x30, 0x29, 0x5b, 0x74, 0x5f, 0x76, 0x26, 0x33, 0x5d,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x76, 0x65, 0x63,
+  0x33, 0x20, 0x72, 0x67, 0x62, 0x3d, 0x79, 0x75, 0x76, 0x43, 0x6f, 0x6c,
+  0x6f, 0x72, 0x2a, 0x76, 0x65, 0x63, 0x33, 0x28, 0x79, 0x2c, 0x75, 0x2d,
+  0x31, 0x32, 0x38, 0x2c, 0x76, 0x2d, 0x31, 0x32, 0x38, 0x29, 0x3b, 0x0a,
+  0x20, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3d, 0x72, 0x67, 0x62, 0x2f,
+  0x32, 0x35, 0x35, 0x2e, 0x30, 0x3b, 0x0a, 0x7d, 0x0a
+, 0x00 };
+static const char VERT_FS[] = {
+  0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34, 0x30,
+  0x0a, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x67, 0x6c, 0x6a, 0x5f, 0x72,
+  0x65, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x63, 0x74, 0x38, 0x28, 0x6f, 0x75,
+  0x74, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x78, 0x5b, 0x38, 0x5d,
+  0x2c, 0x20, 0x63, 0x6f, 0x6e, 0x73, 0x74, 0x20, 0x66, 0x6c, 0x6f, 0x61,
+  0x74, 0x20, 0x79, 0x5b, 0x38, 0x5d, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x30, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x32, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x74, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x30, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x31, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x38, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x30, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x30, 0x5d, 0x3b, 0x0a, 0x20,
+  0x20, 0x75, 0x34, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x31, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x74, 0x32, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x32, 0x5d, 0x3b,
+  0x0a, 0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x33, 0x5d,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x79, 0x5b, 0x34,
+  0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d, 0x20, 0x79, 0x5b,
+  0x35, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x33, 0x20, 0x3d, 0x20, 0x79,
+  0x5b, 0x36, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x37, 0x20, 0x3d, 0x20,
+  0x79, 0x5b, 0x37, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x2f, 0x2a, 0x20, 0x45,
+  0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64, 0x20, 0x73, 0x63, 0x61, 0x6c,
+  0x65, 0x64, 0x20, 0x69, 0x6e, 0x76, 0x65, 0x72, 0x73, 0x65, 0x20, 0x34,
+  0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20, 0x54, 0x79, 0x70, 0x65, 0x2d,
+  0x49, 0x49, 0x20, 0x44, 0x43, 0x54, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20,
+  0x75, 0x30, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2b, 0x20, 0x74, 0x31,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x31, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20,
+  0x2d, 0x20, 0x74, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x33, 0x20, 0x3d,
+  0x20, 0x74, 0x32, 0x20, 0x2b, 0x20, 0x74, 0x33, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x32, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x32, 0x20, 0x2d, 0x20, 0x74,
+  0x33, 0x29, 0x2a, 0x31, 0x2e, 0x34, 0x31, 0x34, 0x32, 0x31, 0x33, 0x35,
+  0x36, 0x32, 0x33, 0x37, 0x33, 0x30, 0x39, 0x35, 0x30, 0x34, 0x38, 0x38,
+  0x30, 0x31, 0x36, 0x38, 0x38, 0x37, 0x32, 0x34, 0x32, 0x30, 0x39, 0x37,
+  0x20, 0x2d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x30, 0x20,
+  0x3d, 0x20, 0x75, 0x30, 0x20, 0x2b, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20,
+  0x20, 0x74, 0x33, 0x20, 0x3d, 0x20, 0x75, 0x30, 0x20, 0x2d, 0x20, 0x75,
+  0x33, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x31, 0x20, 0x3d, 0x20, 0x75, 0x31,
+  0x20, 0x2b, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x32, 0x20,
+  0x3d, 0x20, 0x75, 0x31, 0x20, 0x2d, 0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20,
+  0x20, 0x2f, 0x2a, 0x20, 0x45, 0x6d, 0x62, 0x65, 0x64, 0x64, 0x65, 0x64,
+  0x20, 0x73, 0x63, 0x61, 0x6c, 0x65, 0x64, 0x20, 0x69, 0x6e, 0x76, 0x65,
+  0x72, 0x73, 0x65, 0x20, 0x34, 0x2d, 0x70, 0x6f, 0x69, 0x6e, 0x74, 0x20,
+  0x54, 0x79, 0x70, 0x65, 0x2d, 0x49, 0x56, 0x20, 0x44, 0x53, 0x54, 0x20,
+  0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x74, 0x35, 0x20, 0x3d, 0x20, 0x75, 0x35,
+  0x20, 0x2b, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x36, 0x20,
+  0x3d, 0x20, 0x75, 0x35, 0x20, 0x2d, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20,
+  0x20, 0x74, 0x37, 0x20, 0x3d, 0x20, 0x75, 0x34, 0x20, 0x2b, 0x20, 0x75,
+  0x37, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x34, 0x20, 0x3d, 0x20, 0x75, 0x34,
+  0x20, 0x2d, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x37, 0x20,
+  0x3d, 0x20, 0x74, 0x37, 0x20, 0x2b, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20,
+  0x20, 0x75, 0x35, 0x20, 0x3d, 0x20, 0x28, 0x74, 0x37, 0x20, 0x2d, 0x20,
+  0x74, 0x35, 0x29, 0x2a, 0x31, 0x2e, 0x34, 0x31, 0x34, 0x32, 0x31, 0x33,
+  0x35, 0x36, 0x32, 0x33, 0x37, 0x33, 0x30, 0x39, 0x35, 0x30, 0x34, 0x38,
+  0x38, 0x30, 0x31, 0x36, 0x38, 0x38, 0x37, 0x32, 0x34, 0x32, 0x30, 0x39,
+  0x37, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x38, 0x20, 0x3d, 0x20, 0x28, 0x74,
+  0x34, 0x20, 0x2b, 0x20, 0x74, 0x36, 0x29, 0x2a, 0x31, 0x2e, 0x38, 0x34,
+  0x37, 0x37, 0x35, 0x39, 0x30, 0x36, 0x35, 0x30, 0x32, 0x32, 0x35, 0x37,
+  0x33, 0x35, 0x31, 0x32, 0x32, 0x35, 0x36, 0x33, 0x36, 0x36, 0x33, 0x37,
+  0x38, 0x37, 0x39, 0x33, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x34, 0x20,
+  0x3d, 0x20, 0x75, 0x38, 0x20, 0x2d, 0x20, 0x74, 0x34, 0x2a, 0x31, 0x2e,
+  0x30, 0x38, 0x32, 0x33, 0x39, 0x32, 0x32, 0x30, 0x30, 0x32, 0x39, 0x32,
+  0x33, 0x39, 0x33, 0x39, 0x36, 0x38, 0x37, 0x39, 0x39, 0x34, 0x34, 0x36,
+  0x34, 0x31, 0x30, 0x37, 0x33, 0x32, 0x38, 0x3b, 0x0a, 0x20, 0x20, 0x75,
+  0x36, 0x20, 0x3d, 0x20, 0x75, 0x38, 0x20, 0x2d, 0x20, 0x74, 0x36, 0x2a,
+  0x32, 0x2e, 0x36, 0x31, 0x33, 0x31, 0x32, 0x35, 0x39, 0x32, 0x39, 0x37,
+  0x35, 0x32, 0x37, 0x35, 0x33, 0x30, 0x35, 0x35, 0x37, 0x31, 0x33, 0x32,
+  0x38, 0x36, 0x33, 0x34, 0x36, 0x38, 0x35, 0x34, 0x34, 0x3b, 0x0a, 0x20,
+  0x20, 0x74, 0x37, 0x20, 0x3d, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x74, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x37, 0x20, 0x2d, 0x20, 0x75, 0x36,
+  0x3b, 0x0a, 0x20, 0x20, 0x74, 0x35, 0x20, 0x3d, 0x20, 0x74, 0x36, 0x20,
+  0x2b, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x74, 0x34, 0x20, 0x3d,
+  0x20, 0x74, 0x35, 0x20, 0x2d, 0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x2f, 0x2a, 0x20, 0x42, 0x75, 0x74, 0x74, 0x65, 0x72, 0x66, 0x6c, 0x69,
+  0x65, 0x73, 0x20, 0x2a, 0x2f, 0x0a, 0x20, 0x20, 0x75, 0x30, 0x20, 0x3d,
+  0x20, 0x74, 0x30, 0x20, 0x2b, 0x20, 0x74, 0x37, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x37, 0x20, 0x3d, 0x20, 0x74, 0x30, 0x20, 0x2d, 0x20, 0x74, 0x37,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x36, 0x20, 0x3d, 0x20, 0x74, 0x31, 0x20,
+  0x2b, 0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x31, 0x20, 0x3d,
+  0x20, 0x74, 0x31, 0x20, 0x2d, 0x20, 0x74, 0x36, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x32, 0x20, 0x3d, 0x20, 0x74, 0x32, 0x20, 0x2b, 0x20, 0x74, 0x35,
+  0x3b, 0x0a, 0x20, 0x20, 0x75, 0x35, 0x20, 0x3d, 0x20, 0x74, 0x32, 0x20,
+  0x2d, 0x20, 0x74, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x75, 0x34, 0x20, 0x3d,
+  0x20, 0x74, 0x33, 0x20, 0x2b, 0x20, 0x74, 0x34, 0x3b, 0x0a, 0x20, 0x20,
+  0x75, 0x33, 0x20, 0x3d, 0x20, 0x74, 0x33, 0x20, 0x2d, 0x20, 0x74, 0x34,
+  0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x30, 0x5d, 0x20, 0x3d, 0x20, 0x75,
+  0x30, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x31, 0x5d, 0x20, 0x3d, 0x20,
+  0x75, 0x31, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x32, 0x5d, 0x20, 0x3d,
+  0x20, 0x75, 0x32, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x33, 0x5d, 0x20,
+  0x3d, 0x20, 0x75, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x34, 0x5d,
+  0x20, 0x3d, 0x20, 0x75, 0x34, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b, 0x35,
+  0x5d, 0x20, 0x3d, 0x20, 0x75, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x78, 0x5b,
+  0x36, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x36, 0x3b, 0x0a, 0x20, 0x20, 0x78,
+  0x5b, 0x37, 0x5d, 0x20, 0x3d, 0x20, 0x75, 0x37, 0x3b, 0x0a, 0x7d, 0x0a,
+  0x0a, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x65, 0x78,
+  0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x0a, 0x6f, 0x75, 0x74,
+  0x20, 0x69, 0x76, 0x65, 0x63, 0x34, 0x20, 0x76, 0x5f, 0x6c, 0x6f, 0x77,
+  0x3b, 0x0a, 0x6f, 0x75, 0x74, 0x20, 0x69, 0x76, 0x65, 0x63, 0x34, 0x20,
+  0x76, 0x5f, 0x68, 0x69, 0x67, 0x68, 0x3b, 0x0a, 0x0a, 0x75, 0x6e, 0x69,
+  0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72,
+  0x32, 0x44, 0x20, 0x68, 0x5f, 0x6c, 0x6f, 0x77, 0x3b, 0x0a, 0x75, 0x6e,
+  0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65,
+  0x72, 0x32, 0x44, 0x20, 0x68, 0x5f, 0x68, 0x69, 0x67, 0x68, 0x3b, 0x0a,
+  0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69, 0x6e, 0x28, 0x29,
+  0x20, 0x7b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x73, 0x3d, 0x69,
+  0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64,
+  0x2e, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x74,
+  0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f, 0x6f,
+  0x72, 0x64, 0x2e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74,
+  0x20, 0x75, 0x3d, 0x73, 0x3e, 0x3e, 0x33, 0x3b, 0x0a, 0x20, 0x20, 0x69,
+  0x6e, 0x74, 0x20, 0x76, 0x3d, 0x74, 0x3c, 0x3c, 0x33, 0x3b, 0x0a, 0x20,
+  0x20, 0x69, 0x6e, 0x74, 0x20, 0x69, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c,
+  0x6f, 0x61, 0x74, 0x20, 0x78, 0x5b, 0x38, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x79, 0x5b, 0x38, 0x5d, 0x3b, 0x0a,
+  0x20, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x6a, 0x3d, 0x73, 0x25, 0x38, 0x3b,
+  0x0a, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x6a, 0x3c, 0x34, 0x29, 0x20,
+  0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72, 0x20, 0x28, 0x69,
+  0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c, 0x20, 0x38, 0x3b,
+  0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20,
+  0x20, 0x20, 0x79, 0x5b, 0x37, 0x2d, 0x69, 0x5d, 0x3d, 0x74, 0x65, 0x78,
+  0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x68, 0x5f, 0x6c, 0x6f,
+  0x77, 0x2c, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x75, 0x2c, 0x76, 0x2b,
+  0x69, 0x29, 0x2c, 0x30, 0x29, 0x5b, 0x6a, 0x5d, 0x3b, 0x0a, 0x20, 0x20,
+  0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20, 0x65, 0x6c,
+  0x73, 0x65, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6f, 0x72,
+  0x20, 0x28, 0x69, 0x20, 0x3d, 0x20, 0x30, 0x3b, 0x20, 0x69, 0x20, 0x3c,
+  0x20, 0x38, 0x3b, 0x20, 0x69, 0x2b, 0x2b, 0x29, 0x20, 0x7b, 0x0a, 0x20,
+  0x20, 0x20, 0x20, 0x20, 0x20, 0x79, 0x5b, 0x37, 0x2d, 0x69, 0x5d, 0x3d,
+  0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x68,
+  0x5f, 0x68, 0x69, 0x67, 0x68, 0x2c, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28,
+  0x75, 0x2c, 0x76, 0x2b, 0x69, 0x29, 0x2c, 0x30, 0x29, 0x5b, 0x6a, 0x2d,
+  0x34, 0x5d, 0x3b, 0x0a, 0x20, 0x20, 0x20, 0x20, 0x7d, 0x0a, 0x20, 0x20,
+  0x7d, 0x0a, 0x20, 0x20, 0x79, 0x5b, 0x30, 0x5d, 0x20, 0x2b, 0x3d, 0x20,
+  0x30, 0x2e, 0x35, 0x3b, 0x0a, 0x20, 0x20, 0x67, 0x6c, 0x6a, 0x5f, 0x72,
+  0x65, 0x61, 0x6c, 0x5f, 0x69, 0x64, 0x63, 0x74, 0x38, 0x28, 0x78, 0x2c,
+  0x20, 0x79, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x76, 0x5f, 0x6c, 0x6f, 0x77,
+  0x3d, 0x69, 0x76, 0x65, 0x63, 0x34, 0x28, 0x78, 0x5b, 0x30, 0x5d, 0x2c,
+  0x78, 0x5b, 0x31, 0x5d, 0x2c, 0x78, 0x5b, 0x32, 0x5d, 0x2c, 0x78, 0x5b,
+  0x33, 0x5d, 0x29, 0x2b, 0x69, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x32,
+  0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x76, 0x5f, 0x68, 0x69, 0x67, 0x68,
+  0x3d, 0x69, 0x76, 0x65, 0x63, 0x34, 0x28, 0x78, 0x5b, 0x34, 0x5d, 0x2c,
+  0x78, 0x5b, 0x35, 0x5d, 0x2c, 0x78, 0x5b, 0x36, 0x5d, 0x2c, 0x78, 0x5b,
+  0x37, 0x5d, 0x29, 0x2b, 0x69, 0x76, 0x65, 0x63, 0x34, 0x28, 0x31, 0x32,
+  0x38, 0x29, 0x3b, 0x0a, 0x7d, 0x0a
+, 0x00 };
+static const char YUV_FS[] = {
+  0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6f, 0x6e, 0x20, 0x31, 0x34, 0x30,
+  0x0a, 0x69, 0x6e, 0x20, 0x76, 0x65, 0x63, 0x32, 0x20, 0x74, 0x65, 0x78,
+  0x5f, 0x63, 0x6f, 0x6f, 0x72, 0x64, 0x3b, 0x0a, 0x6f, 0x75, 0x74, 0x20,
+  0x76, 0x65, 0x63, 0x33, 0x20, 0x63, 0x6f, 0x6c, 0x6f, 0x72, 0x3b, 0x0a,
+  0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x75, 0x5f, 0x78, 0x64, 0x65, 0x63, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66,
+  0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20, 0x75, 0x5f, 0x79, 0x64,
+  0x65, 0x63, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20,
+  0x69, 0x6e, 0x74, 0x20, 0x76, 0x5f, 0x78, 0x64, 0x65, 0x63, 0x3b, 0x0a,
+  0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x76, 0x5f, 0x79, 0x64, 0x65, 0x63, 0x3b, 0x0a, 0x75, 0x6e, 0x69, 0x66,
+  0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d, 0x70, 0x6c, 0x65, 0x72,
+  0x32, 0x44, 0x20, 0x79, 0x5f, 0x74, 0x65, 0x78, 0x3b, 0x0a, 0x75, 0x6e,
+  0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d, 0x70, 0x6c,
+  0x65, 0x72, 0x32, 0x44, 0x20, 0x75, 0x5f, 0x74, 0x65, 0x78, 0x3b, 0x0a,
+  0x75, 0x6e, 0x69, 0x66, 0x6f, 0x72, 0x6d, 0x20, 0x75, 0x73, 0x61, 0x6d,
+  0x70, 0x6c, 0x65, 0x72, 0x32, 0x44, 0x20, 0x76, 0x5f, 0x74, 0x65, 0x78,
+  0x3b, 0x0a, 0x6d, 0x61, 0x74, 0x33, 0x20, 0x79, 0x75, 0x76, 0x43, 0x6f,
+  0x6c, 0x6f, 0x72, 0x20, 0x3d, 0x20, 0x6d, 0x61, 0x74, 0x33, 0x28, 0x0a,
+  0x20, 0x20, 0x31, 0x2e, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x31, 0x2e,
+  0x30, 0x2c, 0x20, 0x20, 0x20, 0x20, 0x20, 0x31, 0x2e, 0x30, 0x2c, 0x0a,
+  0x20, 0x20, 0x30, 0x2e, 0x30, 0x2c, 0x20, 0x20, 0x20, 0x2d, 0x30, 0x2e,
+  0x33, 0x34, 0x34, 0x31, 0x34, 0x2c, 0x20, 0x31, 0x2e, 0x37, 0x37, 0x32,
+  0x2c, 0x0a, 0x20, 0x20, 0x31, 0x2e, 0x34, 0x30, 0x32, 0x2c, 0x20, 0x2d,
+  0x30, 0x2e, 0x37, 0x31, 0x34, 0x31, 0x34, 0x2c, 0x20, 0x30, 0x2e, 0x30,
+  0x0a, 0x29, 0x3b, 0x0a, 0x76, 0x6f, 0x69, 0x64, 0x20, 0x6d, 0x61, 0x69,
+  0x6e, 0x28, 0x29, 0x20, 0x7b, 0x0a, 0x20, 0x20, 0x69, 0x6e, 0x74, 0x20,
+  0x73, 0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f, 0x63, 0x6f,
+  0x6f, 0x72, 0x64, 0x2e, 0x73, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x69, 0x6e,
+  0x74, 0x20, 0x74, 0x3d, 0x69, 0x6e, 0x74, 0x28, 0x74, 0x65, 0x78, 0x5f,
+  0x63, 0x6f, 0x6f, 0x72, 0x64, 0x2e, 0x74, 0x29, 0x3b, 0x0a, 0x20, 0x20,
+  0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x79, 0x3d, 0x66, 0x6c, 0x6f, 0x61,
+  0x74, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68,
+  0x28, 0x79, 0x5f, 0x74, 0x65, 0x78, 0x2c, 0x69, 0x76, 0x65, 0x63, 0x32,
+  0x28, 0x73, 0x2c, 0x74, 0x29, 0x2c, 0x30, 0x29, 0x2e, 0x72, 0x29, 0x3b,
+  0x0a, 0x20, 0x20, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x20, 0x75, 0x3d, 0x66,
+  0x6c, 0x6f, 0x61, 0x74, 0x28, 0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65,
+  0x74, 0x63, 0x68, 0x28, 0x75, 0x5f, 0x74, 0x65, 0x78, 0x2c, 0x69, 0x76,
+  0x65, 0x63, 0x32, 0x28, 0x73, 0x3e, 0x3e, 0x75, 0x5f, 0x78, 0x64, 0x65,
+  0x63, 0x2c, 0x74, 0x3e, 0x3e, 0x75, 0x5f, 0x79, 0x64, 0x65, 0x63, 0x29,
+  0x2c, 0x30, 0x29, 0x2e, 0x72, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x66, 0x6c,
+  0x6f, 0x61, 0x74, 0x20, 0x76, 0x3d, 0x66, 0x6c, 0x6f, 0x61, 0x74, 0x28,
+  0x74, 0x65, 0x78, 0x65, 0x6c, 0x46, 0x65, 0x74, 0x63, 0x68, 0x28, 0x76,
+  0x5f, 0x74, 0x65, 0x78, 0x2c, 0x69, 0x76, 0x65, 0x63, 0x32, 0x28, 0x73,
+  0x3e, 0x3e, 0x76, 0x5f, 0x78, 0x64, 0x65, 0x63, 0x2c, 0x74, 0x3e, 0x3e,
+  0x76, 0x5f, 0x79, 0x64, 0x65, 0x63, 0x29, 0x2c, 0x30, 0x29, 0x2e, 0x72,
+  0x29, 0x3b, 0x0a, 0x20, 0x20, 0x76, 0x65, 0x63, 0x33, 0x20, 0x72, 0x67,
+  0x62, 0x3d, 0x79, 0x75, 0x76, 0x43, 0x6f, 0x6c, 0x6f, 0x72, 0x2a, 0x76,
+  0x65, 0x63, 0x33, 0x28, 0x79, 0x2c, 0x75, 0x2d, 0x31, 0x32, 0x38, 0x2c,
+  0x76, 0x2d, 0x31, 0x32, 0x38, 0x29, 0x3b, 0x0a, 0x20, 0x20, 0x63, 0x6f,
+  0x6c, 0x6f, 0x72, 0x3d, 0x72, 0x67, 0x62, 0x2f, 0x32, 0x35, 0x35, 0x2e,
+  0x30, 0x3b, 0x0a, 0x7d, 0x0a
+, 0x00 };
@@ -13,10 +13,18 @@ Unless required by applicable law or agreed to in writing, software distributed
 See the License for the specific language governing permissions and limitations
  under the License. */
 
+#define _POSIX_C_SOURCE 200112L
+
+#include <limits.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #include "jpeg_info.h"
+#include "internal.h"
 
 const char *JPEG_SUBSAMP_NAMES[JPEG_SUBSAMP_MAX] = {
   "Unknown",
@@ -28,9 +36,94 @@ const char *JPEG_SUBSAMP_NAMES[JPEG_SUBSAMP_MAX] = {
   "Mono",
 };
 
+int jpeg_header_crop(jpeg_header *header, jpeg_crop *crop) {
+  int hmax;
+  int vmax;
+  int x0;
+  int y0;
+  int x1;
+  int y1;
+  int i;
+  if (crop->width <= 0 || crop->height <= 0 || crop->x < 0 || crop->y < 0 ||
+   crop->x >= header->width || crop->y >= header->height) {
+    fprintf(stderr, "Error, crop %ix%i+%i+%i is outside the %ix%i image\n",
+     crop->width, crop->height, crop->x, crop->y, header->width,
+     header->height);
+    return EXIT_FAILURE;
+  }
+  hmax = 0;
+  vmax = 0;
+  for (i = 0; i < header->ncomps; i++) {
+    hmax = GLJ_MAXI(hmax, header->comp[i].hsamp);
+    vmax = GLJ_MAXI(vmax, header->comp[i].vsamp);
+  }
+  /* The region in MCUs */
+  x0 = crop->x/(hmax << 3);
+  y0 = crop->y/(vmax << 3);
+  x1 = (GLJ_MINI(crop->x + crop->width, header->width) + (hmax << 3) - 1)/
+   (hmax << 3);
+  y1 = (GLJ_MINI(crop->y + crop->height, header->height) + (vmax << 3) - 1)/
+   (vmax << 3);
+  crop->x = x0*hmax << 3;
+  crop->y = y0*vmax << 3;
+  crop->width = GLJ_MINI(x1*hmax << 3, header->width) - crop->x;
+  crop->height = GLJ_MINI(y1*vmax << 3, header->height) - crop->y;
+  header->width = crop->width;
+  header->height = crop->height;
+  for (i = 0; i < header->ncomps; i++) {
+    header->comp[i].hblocks = (x1 - x0)*header->comp[i].hsamp;
+    header->comp[i].vblocks = (y1 - y0)*header->comp[i].vsamp;
+  }
+  return EXIT_SUCCESS;
+}
+
+int jpeg_header_scale(jpeg_header *header, int scale) {
+  if (scale < 0 || scale > 3) {
+    fprintf(stderr, "Error, scale %i is not in the range 0 to 3\n", scale);
+    return EXIT_FAILURE;
+  }
+  header->width = (header->width + (1 << scale) - 1) >> scale;
+  header->height = (header->height + (1 << scale) - 1) >> scale;
+  header->scale = scale;
+  return EXIT_SUCCESS;
+}
+
+/* Map a regular file read-only instead of copying it to the heap, so the
+    decoders read it straight from the page cache.
+   Returns EXIT_FAILURE if the file cannot be mapped, e.g., it is a pipe. */
+static int jpeg_info_map(jpeg_info *info, const char *name) {
+  int fd;
+  struct stat st;
+  void *map;
+  fd = open(name, O_RDONLY);
+  if (fd < 0) {
+    return EXIT_FAILURE;
+  }
+  map = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && st.st_size > 0 &&
+   st.st_size <= INT_MAX) {
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd);
+  if (map == MAP_FAILED) {
+    return EXIT_FAILURE;
+  }
+  /* The whole file is decoded, mostly front to back */
+  posix_madvise(map, st.st_size, POSIX_MADV_SEQUENTIAL);
+  posix_madvise(map, st.st_size, POSIX_MADV_WILLNEED);
+  jpeg_info_clear(info);
+  info->buf = (unsigned char *)map;
+  info->size = (int)st.st_size;
+  info->mapped = 1;
+  return EXIT_SUCCESS;
+}
+
 int jpeg_info_init(jpeg_info *info, const char *name) {
   FILE *fp;
   int size;
+  if (jpeg_info_map(info, name) == EXIT_SUCCESS) {
+    return EXIT_SUCCESS;
+  }
   fp = fopen(name, "rb");
   if (fp == NULL) {
     fprintf(stderr, "Error, could not open jpeg file %s\n", name);
@@ -56,6 +149,13 @@ int jpeg_info_init(jpeg_info *info, const char *name) {
 }
 
 void jpeg_info_clear(jpeg_info *info) {
-  free(info->buf);
+  if (info->buf != NULL) {
+    if (info->mapped) {
+      munmap(info->buf, info->size);
+    }
+    else {
+      free(info->buf);
+    }
+  }
   memset(info, 0, sizeof(jpeg_info));
 }
@@ -61,15 +61,46 @@ struct jpeg_header {
   int restart_interval;
   jpeg_component comp[NCOMPS_MAX];
   jpeg_quant quant[NQUANT_MAX];
+  /* The log2 of the factor the decoded samples are scaled down by */
+  int scale;
 };
 
+typedef struct jpeg_crop jpeg_crop;
+
+/* A rectangle of the image in pixels */
+struct jpeg_crop {
+  int x;
+  int y;
+  int width;
+  int height;
+};
+
+/* Expand crop to whole MCUs, clipped to the image, and change header to
+    describe only that region, so that image_init() allocates an image of its
+    size.
+   Returns EXIT_FAILURE if crop does not overlap the image. */
+int jpeg_header_crop(jpeg_header *header, jpeg_crop *crop);
+
+/* Change header to describe the image scaled down by 2^scale in each
+    direction, from 0 (full size) to 3 (one sample per block), so that
+    image_init() allocates planes of that size.
+   This must be done after jpeg_header_crop(), whose crop is in full size
+    pixels.
+   Returns EXIT_FAILURE if scale is out of range. */
+int jpeg_header_scale(jpeg_header *header, int scale);
+
 typedef struct jpeg_info jpeg_info;
 
 struct jpeg_info {
   int size;
   unsigned char *buf;
+  /* Is buf a read-only mapping of the file rather than a copy of it */
+  int mapped;
 };
 
+/* Load the file name into info, replacing what info held before, which must
+    be zeroed or at least have buf set to NULL the first time.
+   Regular files are memory mapped, so buf must not be written to. */
 int jpeg_info_init(jpeg_info *info, const char *name);
 void jpeg_info_clear(jpeg_info *info);
 
@@ -27,6 +27,8 @@ const char *JPEG_DECODE_OUT_NAMES[JPEG_DECODE_OUT_MAX] = {
   "dct",
   "yuv",
   "rgb",
+  "rgba",
+  "bgra"
 };
 
 static jpeg_subsamp decode_subsamp(jpeg_header *headers) {
@@ -88,6 +90,7 @@ static int libjpeg_decode_header(libjpeg_decode_ctx *ctx,
   headers->bits = ctx->cinfo.data_precision;
   headers->ncomps = ctx->cinfo.num_components;
   headers->restart_interval = ctx->cinfo.restart_interval;
+  headers->scale = 0;
 
   if (headers->ncomps != 1 && headers->ncomps != 3) {
     fprintf(stderr, "Unsupported number of components %i\n", headers->ncomps);
@@ -131,8 +134,152 @@ static int libjpeg_decode_header(libjpeg_decode_ctx *ctx,
   return EXIT_SUCCESS;
 }
 
+/* The size in samples of the output blocks of a component, which libjpeg
+    may make larger than the scaled DCT size of the image to avoid upsampling
+    the component when scaling down. */
+#if JPEG_LIB_VERSION >= 70
+# define LIBJPEG_BLOCK_SIZE(info) ((info)->DCT_v_scaled_size)
+#else
+# define LIBJPEG_BLOCK_SIZE(info) ((info)->DCT_scaled_size)
+#endif
+
+/* Read the raw YUV data of the MCU rows [y0, y1) into the image planes,
+    keeping only the columns from MCU x0 on.
+   libjpeg cannot crop raw data, so every MCU row is read into a buffer of the
+    full width and the rows after the region are not decoded at all.
+   The components that libjpeg scaled down less than the image are averaged
+    down to the size of the planes.
+   This matches how libjpeg-turbo and libjpeg 6b scale: their reduced size
+    inverse DCTs (jidctred.c) output the averages of the samples of the full
+    8x8 inverse DCT, so the scaled planes are box filtered full size planes.
+   xjpeg instead takes the N-point inverse DCT of the low frequencies, which
+    is sharper, so their scaled yuv output differs by more than rounding,
+    e.g., by tens of levels at 1/2 and 1/4 scale near strong edges. */
+static int libjpeg_read_raw_crop(libjpeg_decode_ctx *ctx, image *img, int x0,
+ int y0, int y1) {
+  JSAMPROW rows[NCOMPS_MAX][MAX_SAMP_FACTOR*DCTSIZE];
+  JSAMPROW *plane_pointer[NCOMPS_MAX];
+  unsigned char *buf[NCOMPS_MAX];
+  int width[NCOMPS_MAX];
+  int height[NCOMPS_MAX];
+  int size;
+  int mcu_width;
+  int mcu_height;
+  int nhmb;
+  int nvmb;
+  int i;
+  int j;
+  mcu_width = ctx->cinfo.max_h_samp_factor*DCTSIZE;
+  mcu_height = ctx->cinfo.max_v_samp_factor*DCTSIZE;
+  nhmb = (ctx->cinfo.image_width + mcu_width - 1)/mcu_width;
+  nvmb = (ctx->cinfo.image_height + mcu_height - 1)/mcu_height;
+  /* The size of a block and the height of an MCU in the scaled output */
+  size = DCTSIZE >> img->scale;
+  mcu_height = ctx->cinfo.max_v_samp_factor*size;
+  for (i = 0; i < img->nplanes; i++) {
+    jpeg_component_info *info;
+    info = &ctx->cinfo.comp_info[i];
+    width[i] = nhmb*info->h_samp_factor*LIBJPEG_BLOCK_SIZE(info);
+    height[i] = info->v_samp_factor*LIBJPEG_BLOCK_SIZE(info);
+    buf[i] = (unsigned char *)malloc(width[i]*height[i]);
+    if (buf[i] == NULL) {
+      while (i-- > 0) {
+        free(buf[i]);
+      }
+      return EXIT_FAILURE;
+    }
+    for (j = 0; j < height[i]; j++) {
+      rows[i][j] = buf[i] + j*width[i];
+    }
+    plane_pointer[i] = rows[i];
+  }
+  while (ctx->cinfo.output_scanline < ctx->cinfo.output_height) {
+    int mby;
+    mby = ctx->cinfo.output_scanline/mcu_height;
+    if (mby >= y1) {
+      break;
+    }
+    if (mby < y0) {
+      jpeg_read_raw_data(&ctx->cinfo, plane_pointer, mcu_height);
+      continue;
+    }
+    /* libjpeg does not write the blocks past the edges of the image, so clear
+        them to match the planes of an uncropped decode */
+    if (mby == y0 || mby == nvmb - 1) {
+      for (i = 0; i < img->nplanes; i++) {
+        memset(buf[i], 0, width[i]*height[i]);
+      }
+    }
+    jpeg_read_raw_data(&ctx->cinfo, plane_pointer, mcu_height);
+    for (i = 0; i < img->nplanes; i++) {
+      image_plane *plane;
+      unsigned char *data;
+      int nrows;
+      int x;
+      int f;
+      plane = &img->plane[i];
+      nrows = ctx->cinfo.comp_info[i].v_samp_factor*size;
+      x = x0*ctx->cinfo.comp_info[i].h_samp_factor*size;
+      data = &plane->data[(mby - y0)*nrows*plane->ystride];
+      f = height[i]/nrows;
+      if (f == 1) {
+        for (j = 0; j < nrows; j++) {
+          memcpy(data + j*plane->ystride, rows[i][j] + x, plane->width);
+        }
+      }
+      else {
+        int k;
+        for (j = 0; j < nrows; j++) {
+          for (k = 0; k < plane->width; k++) {
+            int sum;
+            int v;
+            int u;
+            sum = 0;
+            for (v = 0; v < f; v++) {
+              for (u = 0; u < f; u++) {
+                sum += rows[i][j*f + v][(x + k)*f + u];
+              }
+            }
+            data[j*plane->ystride + k] = (sum + (f*f >> 1))/(f*f);
+          }
+        }
+      }
+    }
+  }
+  for (i = 0; i < img->nplanes; i++) {
+    free(buf[i]);
+  }
+  return EXIT_SUCCESS;
+}
+
 static int libjpeg_decode_image(libjpeg_decode_ctx *ctx, image *img,
- jpeg_decode_out out) {
+ jpeg_decode_out out, const jpeg_crop *crop) {
+  int mcu_width;
+  int mcu_height;
+  int x0;
+  int y0;
+  int y1;
+  /* The crop region in MCUs, as it was aligned by jpeg_header_crop() */
+  mcu_width = ctx->cinfo.max_h_samp_factor*DCTSIZE;
+  mcu_height = ctx->cinfo.max_v_samp_factor*DCTSIZE;
+  x0 = 0;
+  y0 = 0;
+  y1 = (ctx->cinfo.image_height + mcu_height - 1)/mcu_height;
+  if (crop != NULL) {
+    x0 = crop->x/mcu_width;
+    y0 = crop->y/mcu_height;
+    y1 = (crop->y + crop->height + mcu_height - 1)/mcu_height;
+  }
+  /* libjpeg scales the output in the IDCT, so there are no scaled
+      coefficients */
+  if (img->scale != 0 && out < JPEG_DECODE_YUV) {
+    fprintf(stderr, "Unsupported scaled output '%s' for libjpeg wrapper.\n",
+     JPEG_DECODE_OUT_NAMES[out]);
+    return EXIT_FAILURE;
+  }
+  /* The scaled yuv output is box filtered, see libjpeg_read_raw_crop() */
+  ctx->cinfo.scale_num = 1;
+  ctx->cinfo.scale_denom = 1 << img->scale;
   switch (out) {
     case JPEG_DECODE_QUANT : {
       int i, j;
@@ -140,18 +287,25 @@ static int libjpeg_decode_image(libjpeg_decode_ctx *ctx, image *img,
       coeffs = jpeg_read_coefficients(&ctx->cinfo);
       for (i = 0; i < ctx->cinfo.num_components; i++) {
         jpeg_component_info *info;
+        image_plane *plane;
         JBLOCKARRAY buf;
-        short *coef;
-        JDIMENSION r, bx;
+        int bx0;
+        int by0;
+        int by;
+        int bx;
         info = &ctx->cinfo.comp_info[i];
-        coef = img->plane[i].coef;
-        for (r = 0; r < info->height_in_blocks; r += info->v_samp_factor) {
+        plane = &img->plane[i];
+        bx0 = x0*info->h_samp_factor;
+        by0 = y0*info->v_samp_factor;
+        /* The block arrays are padded to whole MCUs, like the planes */
+        for (by = 0; by < plane->height >> 3; by += info->v_samp_factor) {
           buf = (ctx->cinfo.mem->access_virt_barray)
-           ((j_common_ptr)&ctx->cinfo, coeffs[i], r, info->v_samp_factor, 0);
+           ((j_common_ptr)&ctx->cinfo, coeffs[i], by0 + by,
+           info->v_samp_factor, 0);
           for (j = 0; j < info->v_samp_factor; j++) {
-            for (bx = 0; bx < info->width_in_blocks; bx++) {
-              memcpy(coef, buf[j][bx], sizeof(JBLOCK));
-              coef += 64;
+            for (bx = 0; bx < plane->width >> 3; bx++) {
+              memcpy(plane->coef + (by + j)*(plane->width << 3) + (bx << 6),
+               buf[j][bx0 + bx], sizeof(JBLOCK));
             }
           }
         }
@@ -179,7 +333,15 @@ static int libjpeg_decode_image(libjpeg_decode_ctx *ctx, image *img,
 
       jpeg_start_decompress(&ctx->cinfo);
 
-      while (ctx->cinfo.output_scanline < ctx->cinfo.output_height) {
+      if (crop != NULL || img->scale != 0) {
+        if (libjpeg_read_raw_crop(ctx, img, x0, y0, y1) != EXIT_SUCCESS) {
+          jpeg_abort_decompress(&ctx->cinfo);
+          return EXIT_FAILURE;
+        }
+      }
+
+      while (ctx->cinfo.output_scanline < ctx->cinfo.output_height &&
+       crop == NULL && img->scale == 0) {
         int i, j;
 
         for (i = 0; i < img->nplanes; i++) {
@@ -196,12 +358,26 @@ static int libjpeg_decode_image(libjpeg_decode_ctx *ctx, image *img,
         jpeg_read_raw_data(&ctx->cinfo, plane_pointer, 16);
       }
 
-      jpeg_finish_decompress(&ctx->cinfo);
       break;
     }
-    case JPEG_DECODE_RGB : {
+    case JPEG_DECODE_RGB :
+    case JPEG_DECODE_RGBA :
+    case JPEG_DECODE_BGRA : {
       JSAMPROW row_pointer[1];
-
+      JDIMENSION y_end;
+      int size;
+      int stride;
+
+      if (out != JPEG_DECODE_RGB) {
+#if defined(JCS_EXTENSIONS)
+        ctx->cinfo.out_color_space =
+         out == JPEG_DECODE_RGBA ? JCS_EXT_RGBA : JCS_EXT_BGRA;
+#else
+        fprintf(stderr, "Unsupported output '%s' for libjpeg wrapper.\n",
+         JPEG_DECODE_OUT_NAMES[out]);
+        return EXIT_FAILURE;
+#endif
+      }
       ctx->cinfo.do_fancy_upsampling = FALSE;
       /* JPEG optimization tools like mozjpeg (based on libjpeg) assume a
           specific DCT implementation when doing rate-distortion trellis
@@ -212,13 +388,58 @@ static int libjpeg_decode_image(libjpeg_decode_ctx *ctx, image *img,
 
       jpeg_start_decompress(&ctx->cinfo);
 
+      size = ctx->cinfo.output_components;
+      stride = img->width*size;
+      if (img->pstride != 0) {
+        if (img->pstride < stride) {
+          fprintf(stderr, "Error, pixel stride is shorter than a row of "
+           "pixels\n");
+          jpeg_abort_decompress(&ctx->cinfo);
+          return EXIT_FAILURE;
+        }
+        stride = img->pstride;
+      }
       row_pointer[0] = img->pixels;
-      while (ctx->cinfo.output_scanline < ctx->cinfo.output_height) {
+      y_end = ctx->cinfo.output_height;
+      if (crop != NULL) {
+#if defined(LIBJPEG_TURBO_VERSION_NUMBER) && \
+ LIBJPEG_TURBO_VERSION_NUMBER >= 1005000
+        JDIMENSION x;
+        JDIMENSION width;
+        /* Only the columns of the crop region are decoded and the rows
+            before it are skipped without color conversion */
+        x = crop->x >> img->scale;
+        width = img->width;
+        jpeg_crop_scanline(&ctx->cinfo, &x, &width);
+        jpeg_skip_scanlines(&ctx->cinfo, crop->y >> img->scale);
+        y_end = (crop->y >> img->scale) + img->height;
+#else
+        unsigned char *buf;
+        buf = (unsigned char *)malloc(ctx->cinfo.output_width*size);
+        if (buf == NULL) {
+          jpeg_abort_decompress(&ctx->cinfo);
+          return EXIT_FAILURE;
+        }
+        row_pointer[0] = buf;
+        while (ctx->cinfo.output_scanline <
+         (JDIMENSION)((crop->y >> img->scale) + img->height)) {
+          int y;
+          y = ctx->cinfo.output_scanline - (crop->y >> img->scale);
+          jpeg_read_scanlines(&ctx->cinfo, row_pointer, 1);
+          if (y >= 0) {
+            memcpy(img->pixels + y*stride,
+             buf + (crop->x >> img->scale)*size, img->width*size);
+          }
+        }
+        free(buf);
+        y_end = ctx->cinfo.output_scanline;
+#endif
+      }
+      while (ctx->cinfo.output_scanline < y_end) {
         jpeg_read_scanlines(&ctx->cinfo, row_pointer, 1);
         /* TODO add support for 16-bit output later */
-        row_pointer[0] += img->width*img->nplanes;
+        row_pointer[0] += stride;
       }
-      jpeg_finish_decompress(&ctx->cinfo);
       break;
     }
     default : {
@@ -228,6 +449,16 @@ static int libjpeg_decode_image(libjpeg_decode_ctx *ctx, image *img,
     }
   }
 
+  /* The rows after a crop region are never decoded */
+  if (out != JPEG_DECODE_QUANT) {
+    if (ctx->cinfo.output_scanline < ctx->cinfo.output_height) {
+      jpeg_abort_decompress(&ctx->cinfo);
+    }
+    else {
+      jpeg_finish_decompress(&ctx->cinfo);
+    }
+  }
+
   return EXIT_SUCCESS;
 }
 
@@ -260,12 +491,10 @@ static xjpeg_decode_ctx *xjpeg_decode_alloc(jpeg_info *info) {
   return ctx;
 }
 
-static int xjpeg_decode_header_(xjpeg_decode_ctx *ctx, jpeg_header *headers) {
+int xjpeg_get_header(xjpeg_decode_ctx *ctx, jpeg_header *headers) {
   xjpeg_frame_header *frame;
   int i;
 
-  xjpeg_decode_header(ctx);
-
   if (ctx->error) {
     fprintf(stderr, "%s\n", ctx->error);
     return EXIT_FAILURE;
@@ -287,6 +516,7 @@ static int xjpeg_decode_header_(xjpeg_decode_ctx *ctx, jpeg_header *headers) {
   headers->bits = frame->bits;
   headers->ncomps = frame->ncomps;
   headers->restart_interval = ctx->restart_interval;
+  headers->scale = 0;
 
   for (i = 0; i < NQUANT_MAX; i++) {
     headers->quant[i].valid = ctx->quant[i].valid;
@@ -318,37 +548,82 @@ static int xjpeg_decode_header_(xjpeg_decode_ctx *ctx, jpeg_header *headers) {
   return EXIT_SUCCESS;
 }
 
+static int xjpeg_decode_header_(xjpeg_decode_ctx *ctx, jpeg_header *headers) {
+  xjpeg_decode_header(ctx);
+  return xjpeg_get_header(ctx, headers);
+}
+
 static int xjpeg_decode_image_(xjpeg_decode_ctx *ctx, image *img,
- jpeg_decode_out out) {
-  switch (out) {
-    case JPEG_DECODE_PACK :
-    case JPEG_DECODE_QUANT :
-    case JPEG_DECODE_DCT :
-    case JPEG_DECODE_YUV : {
-      xjpeg_decode_image(ctx, img, (xjpeg_decode_out)out);
-      if (ctx->error) {
-        fprintf(stderr, "%s\n", ctx->error);
-        return EXIT_FAILURE;
-      }
-      break;
-    }
-    default : {
-      fprintf(stderr, "Unsupported output '%s' for xjpeg wrapper.\n",
-       JPEG_DECODE_OUT_NAMES[out]);
-      return EXIT_FAILURE;
-    }
+ jpeg_decode_out out, const jpeg_crop *crop) {
+  memset(&ctx->crop, 0, sizeof(ctx->crop));
+  if (crop != NULL) {
+    int mcu_width;
+    int mcu_height;
+    mcu_width = ctx->frame.hmax << 3;
+    mcu_height = ctx->frame.vmax << 3;
+    ctx->crop.x0 = crop->x/mcu_width;
+    ctx->crop.y0 = crop->y/mcu_height;
+    ctx->crop.x1 = (crop->x + crop->width + mcu_width - 1)/mcu_width;
+    ctx->crop.y1 = (crop->y + crop->height + mcu_height - 1)/mcu_height;
+  }
+  if (img->scale != 0 && out < JPEG_DECODE_YUV) {
+    fprintf(stderr, "Unsupported scaled output '%s' for xjpeg wrapper.\n",
+     JPEG_DECODE_OUT_NAMES[out]);
+    return EXIT_FAILURE;
+  }
+  ctx->scale = img->scale;
+  xjpeg_decode_image(ctx, img, (xjpeg_decode_out)out);
+  if (ctx->error) {
+    fprintf(stderr, "%s\n", ctx->error);
+    return EXIT_FAILURE;
   }
   return EXIT_SUCCESS;
 }
 
 static void xjpeg_decode_reset(xjpeg_decode_ctx *ctx, jpeg_info *info) {
+  xjpeg_index *index;
+  xjpeg_idct idct;
+  int nthreads;
+  index = ctx->index;
+  idct = ctx->idct;
+  nthreads = ctx->nthreads;
   xjpeg_init(ctx, info->buf, info->size);
+  ctx->index = index;
+  ctx->idct = idct;
+  ctx->nthreads = nthreads;
 }
 
 static void xjpeg_decode_free(xjpeg_decode_ctx *ctx) {
+  if (ctx->index != NULL) {
+    xjpeg_index_clear(ctx->index);
+    free(ctx->index);
+  }
   free(ctx);
 }
 
+int xjpeg_use_index(xjpeg_decode_ctx *ctx, jpeg_info *info, const char *name) {
+  xjpeg_index *index;
+  index = (xjpeg_index *)malloc(sizeof(xjpeg_index));
+  if (index == NULL) {
+    fprintf(stderr, "Error allocating jpeg index\n");
+    return EXIT_FAILURE;
+  }
+  if (xjpeg_index_load(index, name) != EXIT_SUCCESS ||
+   !xjpeg_index_match(index, info->buf, info->size)) {
+    xjpeg_index_clear(index);
+    if (xjpeg_index_build(index, info->buf, info->size, 0) != EXIT_SUCCESS) {
+      fprintf(stderr, "Error, could not index the scan of this jpeg\n");
+      free(index);
+      return EXIT_FAILURE;
+    }
+    if (xjpeg_index_save(index, name) != EXIT_SUCCESS) {
+      fprintf(stderr, "Error, could not save jpeg index %s\n", name);
+    }
+  }
+  ctx->index = index;
+  return EXIT_SUCCESS;
+}
+
 const jpeg_decode_ctx_vtbl XJPEG_DECODE_CTX_VTBL = {
   (jpeg_decode_alloc_func)xjpeg_decode_alloc,
   (jpeg_decode_header_func)xjpeg_decode_header_,
@@ -356,3 +631,24 @@ const jpeg_decode_ctx_vtbl XJPEG_DECODE_CTX_VTBL = {
   (jpeg_decode_reset_func)xjpeg_decode_reset,
   (jpeg_decode_free_func)xjpeg_decode_free
 };
+
+int xjpeg_use_idct(xjpeg_decode_ctx *ctx, const char *name) {
+  int i;
+  for (i = 0; i < XJPEG_IDCT_MAX; i++) {
+    if (strcmp(XJPEG_IDCT_NAMES[i], name) == 0) {
+      ctx->idct = (xjpeg_idct)i;
+      return EXIT_SUCCESS;
+    }
+  }
+  fprintf(stderr, "Invalid inverse DCT: %s\n", name);
+  return EXIT_FAILURE;
+}
+
+int xjpeg_use_threads(xjpeg_decode_ctx *ctx, int nthreads) {
+  if (nthreads < 1) {
+    fprintf(stderr, "Invalid number of threads: %i\n", nthreads);
+    return EXIT_FAILURE;
+  }
+  ctx->nthreads = nthreads;
+  return EXIT_SUCCESS;
+}
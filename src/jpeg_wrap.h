@@ -27,6 +27,8 @@ typedef enum jpeg_decode_out {
   JPEG_DECODE_DCT,
   JPEG_DECODE_YUV,
   JPEG_DECODE_RGB,
+  JPEG_DECODE_RGBA,
+  JPEG_DECODE_BGRA,
   JPEG_DECODE_OUT_MAX
 } jpeg_decode_out;
 
@@ -35,8 +37,14 @@ extern const char *JPEG_DECODE_OUT_NAMES[JPEG_DECODE_OUT_MAX];
 typedef jpeg_decode_ctx *(*jpeg_decode_alloc_func)(jpeg_info *info);
 typedef int (*jpeg_decode_header_func)(jpeg_decode_ctx *dec,
  jpeg_header *header);
+/* When crop is not NULL only that rectangle of the image is decoded, into an
+    image sized by jpeg_header_crop().
+   The samples of an image scaled down by jpeg_header_scale() depend on the
+    decoder: libjpeg averages the full size samples while xjpeg reconstructs
+    each block from its low frequencies only, so they differ by more than
+    the rounding of the inverse DCT. */
 typedef int (*jpeg_decode_image_func)(jpeg_decode_ctx *dec, image *img,
- jpeg_decode_out out);
+ jpeg_decode_out out, const jpeg_crop *crop);
 typedef void (*jpeg_decode_reset_func)(jpeg_decode_ctx *dec, jpeg_info *info);
 typedef void (*jpeg_decode_free_func)(jpeg_decode_ctx *dec);
 
@@ -53,4 +61,25 @@ struct jpeg_decode_ctx_vtbl {
 extern const jpeg_decode_ctx_vtbl LIBJPEG_DECODE_CTX_VTBL;
 extern const jpeg_decode_ctx_vtbl XJPEG_DECODE_CTX_VTBL;
 
+struct xjpeg_decode_ctx;
+
+/* Fill in header from the headers xjpeg has decoded so far, e.g., once
+    xjpeg_stream_header() has found the first scan. */
+int xjpeg_get_header(struct xjpeg_decode_ctx *ctx, jpeg_header *header);
+
+/* Decode the scan of info with the index saved in the file name, which is
+    first built and saved if it does not hold an index of this file, i.e.,
+    one of the same size and hash.
+   The index belongs to ctx from then on, and is kept across decode_reset. */
+int xjpeg_use_index(struct xjpeg_decode_ctx *ctx, jpeg_info *info,
+ const char *name);
+
+/* Reconstruct the full scale yuv output of ctx with the inverse DCT called
+    name, float or islow, which is kept across decode_reset. */
+int xjpeg_use_idct(struct xjpeg_decode_ctx *ctx, const char *name);
+
+/* Decode the scans of ctx on nthreads threads, at least 1, instead of one per
+    processor, which is kept across decode_reset. */
+int xjpeg_use_threads(struct xjpeg_decode_ctx *ctx, int nthreads);
+
 #endif
@@ -0,0 +1,235 @@
+/* JPEG GPU project
+Copyright (c) 2014-2016 JPEG GPU project contributors.  All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ use this file except in compliance with the License.
+You may obtain a copy of the License at:
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed
+ under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+ CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and limitations
+ under the License. */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include <stdlib.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "thread.h"
+
+#define THREADS_MAX (64)
+
+static pthread_once_t glj_thread_once = PTHREAD_ONCE_INIT;
+static int glj_ncpus;
+
+static void glj_thread_count_init(void) {
+  long n;
+  n = sysconf(_SC_NPROCESSORS_ONLN);
+  glj_ncpus = n < 1 ? 1 : n > THREADS_MAX ? THREADS_MAX : (int)n;
+}
+
+int glj_thread_count(void) {
+  /* Decoders on several threads may ask at once, so count only once */
+  pthread_once(&glj_thread_once, glj_thread_count_init);
+  return glj_ncpus;
+}
+
+typedef struct glj_task_pool glj_task_pool;
+
+struct glj_task_pool {
+  glj_task_func func;
+  void *ctx;
+  int ntasks;
+  int next;
+  pthread_mutex_t mutex;
+};
+
+typedef struct glj_task_worker glj_task_worker;
+
+struct glj_task_worker {
+  glj_task_pool *pool;
+  int thread;
+};
+
+static void *glj_task_worker_run(void *arg) {
+  glj_task_worker *worker;
+  glj_task_pool *pool;
+  worker = (glj_task_worker *)arg;
+  pool = worker->pool;
+  for (;;) {
+    int task;
+    pthread_mutex_lock(&pool->mutex);
+    task = pool->next++;
+    pthread_mutex_unlock(&pool->mutex);
+    if (task >= pool->ntasks) {
+      break;
+    }
+    (*pool->func)(pool->ctx, worker->thread, task);
+  }
+  return NULL;
+}
+
+int glj_run_tasks(glj_task_func func, void *ctx, int ntasks, int nthreads) {
+  glj_task_pool pool;
+  glj_task_worker worker[THREADS_MAX];
+  pthread_t tid[THREADS_MAX];
+  int i;
+  int n;
+  nthreads = nthreads < 1 ? 1 : nthreads > THREADS_MAX ? THREADS_MAX : nthreads;
+  if (nthreads > ntasks) {
+    nthreads = ntasks;
+  }
+  /* Run small jobs inline without touching pthreads at all. */
+  if (nthreads <= 1) {
+    for (i = 0; i < ntasks; i++) {
+      (*func)(ctx, 0, i);
+    }
+    return EXIT_SUCCESS;
+  }
+  pool.func = func;
+  pool.ctx = ctx;
+  pool.ntasks = ntasks;
+  pool.next = 0;
+  if (pthread_mutex_init(&pool.mutex, NULL) != 0) {
+    return EXIT_FAILURE;
+  }
+  for (i = 0; i < nthreads; i++) {
+    worker[i].pool = &pool;
+    worker[i].thread = i;
+  }
+  /* If a thread cannot be created the remaining workers (including this one)
+      still drain the task queue. */
+  for (n = 1; n < nthreads; n++) {
+    if (pthread_create(&tid[n], NULL, glj_task_worker_run, &worker[n]) != 0) {
+      break;
+    }
+  }
+  glj_task_worker_run(&worker[0]);
+  for (i = 1; i < n; i++) {
+    pthread_join(tid[i], NULL);
+  }
+  pthread_mutex_destroy(&pool.mutex);
+  return EXIT_SUCCESS;
+}
+
+struct glj_ring {
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  int nslots;
+  /* Two queues of slot indices in a single buffer of 2*nslots, those that
+      are free and those that are filled, in the order they were added */
+  int *slot;
+  int nfree;
+  int free_head;
+  int nfilled;
+  int filled_head;
+  int closed;
+};
+
+glj_ring *glj_ring_create(int nslots) {
+  glj_ring *ring;
+  int i;
+  ring = (glj_ring *)malloc(sizeof(glj_ring));
+  if (ring == NULL) {
+    return NULL;
+  }
+  ring->slot = (int *)malloc(2*nslots*sizeof(int));
+  if (ring->slot == NULL) {
+    free(ring);
+    return NULL;
+  }
+  if (pthread_mutex_init(&ring->mutex, NULL) != 0) {
+    free(ring->slot);
+    free(ring);
+    return NULL;
+  }
+  if (pthread_cond_init(&ring->cond, NULL) != 0) {
+    pthread_mutex_destroy(&ring->mutex);
+    free(ring->slot);
+    free(ring);
+    return NULL;
+  }
+  ring->nslots = nslots;
+  for (i = 0; i < nslots; i++) {
+    ring->slot[i] = i;
+  }
+  ring->nfree = nslots;
+  ring->free_head = 0;
+  ring->nfilled = 0;
+  ring->filled_head = 0;
+  ring->closed = 0;
+  return ring;
+}
+
+void glj_ring_destroy(glj_ring *ring) {
+  if (ring != NULL) {
+    pthread_cond_destroy(&ring->cond);
+    pthread_mutex_destroy(&ring->mutex);
+    free(ring->slot);
+    free(ring);
+  }
+}
+
+int glj_ring_acquire(glj_ring *ring, int *filled) {
+  int slot;
+  pthread_mutex_lock(&ring->mutex);
+  while (ring->nfree == 0 && ring->nfilled == 0) {
+    pthread_cond_wait(&ring->cond, &ring->mutex);
+  }
+  *filled = ring->nfree == 0;
+  if (*filled) {
+    slot = ring->slot[ring->nslots + ring->filled_head];
+    ring->filled_head = (ring->filled_head + 1)%ring->nslots;
+    ring->nfilled--;
+  }
+  else {
+    slot = ring->slot[ring->free_head];
+    ring->free_head = (ring->free_head + 1)%ring->nslots;
+    ring->nfree--;
+  }
+  pthread_mutex_unlock(&ring->mutex);
+  return slot;
+}
+
+void glj_ring_push(glj_ring *ring, int slot) {
+  pthread_mutex_lock(&ring->mutex);
+  ring->slot[ring->nslots +
+   (ring->filled_head + ring->nfilled)%ring->nslots] = slot;
+  ring->nfilled++;
+  pthread_cond_broadcast(&ring->cond);
+  pthread_mutex_unlock(&ring->mutex);
+}
+
+int glj_ring_pop(glj_ring *ring) {
+  int slot;
+  pthread_mutex_lock(&ring->mutex);
+  while (ring->nfilled == 0 && !ring->closed) {
+    pthread_cond_wait(&ring->cond, &ring->mutex);
+  }
+  slot = -1;
+  if (ring->nfilled > 0) {
+    slot = ring->slot[ring->nslots + ring->filled_head];
+    ring->filled_head = (ring->filled_head + 1)%ring->nslots;
+    ring->nfilled--;
+  }
+  pthread_mutex_unlock(&ring->mutex);
+  return slot;
+}
+
+void glj_ring_release(glj_ring *ring, int slot) {
+  pthread_mutex_lock(&ring->mutex);
+  ring->slot[(ring->free_head + ring->nfree)%ring->nslots] = slot;
+  ring->nfree++;
+  pthread_cond_broadcast(&ring->cond);
+  pthread_mutex_unlock(&ring->mutex);
+}
+
+void glj_ring_close(glj_ring *ring) {
+  pthread_mutex_lock(&ring->mutex);
+  ring->closed = 1;
+  pthread_cond_broadcast(&ring->cond);
+  pthread_mutex_unlock(&ring->mutex);
+}
@@ -0,0 +1,59 @@
+/* JPEG GPU project
+Copyright (c) 2014-2016 JPEG GPU project contributors.  All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ use this file except in compliance with the License.
+You may obtain a copy of the License at:
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed
+ under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+ CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and limitations
+ under the License. */
+
+#if !defined(_thread_H)
+# define _thread_H (1)
+
+/* A task callback is invoked once for every task index in [0, ntasks).
+   The thread argument is the index in [0, nthreads) of the worker running
+    the task so callers can keep per-thread scratch state. */
+typedef void (*glj_task_func)(void *ctx, int thread, int task);
+
+/* Returns the number of online CPUs (at least 1). */
+int glj_thread_count(void);
+
+/* Runs ntasks tasks on a pool of up to nthreads workers (the calling thread
+    is one of them) and returns once every task has completed.
+   Tasks are handed out in increasing order. */
+int glj_run_tasks(glj_task_func func, void *ctx, int ntasks, int nthreads);
+
+/* A bounded ring of nslots slots passed from a producer to consumers.
+   Every slot starts free, is filled by the producer with glj_ring_push() and
+    returned to it by the consumer that took it with glj_ring_release(). */
+typedef struct glj_ring glj_ring;
+
+/* Returns NULL if the ring cannot be created. */
+glj_ring *glj_ring_create(int nslots);
+
+void glj_ring_destroy(glj_ring *ring);
+
+/* Waits for a free slot and returns its index.
+   So the producer never waits on consumers that are not running, a filled
+    slot is returned instead when none is free, with *filled set, which the
+    producer must consume and release itself. */
+int glj_ring_acquire(glj_ring *ring, int *filled);
+
+void glj_ring_push(glj_ring *ring, int slot);
+
+/* Waits for a filled slot and returns its index, or -1 once the ring is
+    closed and every filled slot has been taken. */
+int glj_ring_pop(glj_ring *ring);
+
+void glj_ring_release(glj_ring *ring, int slot);
+
+/* Called by the producer after its last glj_ring_push(). */
+void glj_ring_close(glj_ring *ring);
+
+#endif
@@ -17,10 +17,20 @@ See the License for the specific language governing permissions and limitations
 #include <stdlib.h>
 #include <string.h>
 #include "xjpeg.h"
+#include "color.h"
 #include "dct.h"
 #include "internal.h"
+#include "thread.h"
 
-#define LOOKUP_BITS (8)
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+#define LOOKUP_BITS (XJPEG_LOOKUP_BITS)
+
+#if LOOKUP_BITS < 9 || LOOKUP_BITS > 11
+# error "XJPEG_LOOKUP_BITS must be between 9 and 11"
+#endif
 
 #define LOGGING_ENABLED (0)
 
@@ -52,6 +62,11 @@ static const int DE_ZIG_ZAG[64] = {
   53, 60, 61, 54, 47, 55, 62, 63
 };
 
+const char *XJPEG_IDCT_NAMES[XJPEG_IDCT_MAX] = {
+  "float",
+  "islow"
+};
+
 #if LOGGING_ENABLED
 static void printBits(int value, int bits) {
   int i;
@@ -126,15 +141,59 @@ static void printBits(int value, int bits) {
     } \
   } while(0)
 
+#define XJPEG_WORD_BITS ((int)sizeof(xjpeg_decode_word)*8)
+
+/* A word with every byte set to 0x01 */
+#define XJPEG_WORD_ONES ((xjpeg_decode_word)-1/0xFF)
+
+/* Load a big-endian xjpeg_decode_word from the bytes at pos.
+   Each shift is split in two so that it is defined for a 32-bit word. */
+#define XJPEG_LOAD_BYTE(pos, i, shift) \
+ ((xjpeg_decode_word)(pos)[i] << (shift)/2 << (shift)/2)
+
+#define XJPEG_LOAD_WORD(pos) \
+ (sizeof(xjpeg_decode_word) == 8 ? \
+  XJPEG_LOAD_BYTE(pos, 0, 56) | XJPEG_LOAD_BYTE(pos, 1, 48) | \
+  XJPEG_LOAD_BYTE(pos, 2, 40) | XJPEG_LOAD_BYTE(pos, 3, 32) | \
+  XJPEG_LOAD_BYTE(pos, 4, 24) | XJPEG_LOAD_BYTE(pos, 5, 16) | \
+  XJPEG_LOAD_BYTE(pos, 6, 8) | (pos)[7] : \
+  XJPEG_LOAD_BYTE(pos, 0, 24) | XJPEG_LOAD_BYTE(pos, 1, 16) | \
+  XJPEG_LOAD_BYTE(pos, 2, 8) | (pos)[3])
+
+/* Non-zero if any byte in the word is 0xFF, i.e., if any byte of its
+    complement is zero. */
+#define XJPEG_WORD_HAS_FF(word) \
+ ((~(word) - XJPEG_WORD_ONES) & (word) & XJPEG_WORD_ONES << 7)
+
+/* Refill bitbuf once half of it or less is left, guaranteeing at least 32
+    valid bits with a 64-bit xjpeg_decode_word.
+   When the next word of the file has no 0xFF byte, and so neither stuffed
+    zeros nor markers, or the data has been through xjpeg_destuff(), as many
+    whole bytes as fit are shifted in at once.
+   Otherwise bytes are read one at a time with XJPEG_FILL_BYTE. */
 #define XJPEG_FILL_BITS(ctx) \
   do { \
-    if ((ctx)->bits <= 16) { \
-      XJPEG_FILL_BYTE(ctx); \
-      XJPEG_FILL_BYTE(ctx); \
-      XJPEG_FILL_BYTE(ctx); \
-      XJPEG_FILL_BYTE(ctx); \
-      XJPEG_FILL_BYTE(ctx); \
-      XJPEG_FILL_BYTE(ctx); \
+    if ((ctx)->bits <= XJPEG_WORD_BITS/2) { \
+      xjpeg_decode_word word; \
+      int nbytes; \
+      word = 0; \
+      if ((ctx)->size >= (int)sizeof(xjpeg_decode_word)) { \
+        word = XJPEG_LOAD_WORD((ctx)->pos); \
+      } \
+      if ((ctx)->size >= (int)sizeof(xjpeg_decode_word) && \
+       ((ctx)->unstuffed || !XJPEG_WORD_HAS_FF(word))) { \
+        nbytes = (XJPEG_WORD_BITS - 1 - (ctx)->bits) >> 3; \
+        (ctx)->bitbuf = ((ctx)->bitbuf << (nbytes << 3)) | \
+         (word >> (XJPEG_WORD_BITS - (nbytes << 3))); \
+        (ctx)->bits += nbytes << 3; \
+        (ctx)->pos += nbytes; \
+        (ctx)->size -= nbytes; \
+      } \
+      else { \
+        while ((ctx)->bits <= XJPEG_WORD_BITS - 8) { \
+          XJPEG_FILL_BYTE(ctx); \
+        } \
+      } \
     } \
   } \
   while (0)
@@ -168,21 +227,17 @@ static void printBits(int value, int bits) {
     XJPEG_FILL_BITS(ctx); \
     XJPEG_PEEK_BITS(ctx, LOOKUP_BITS, value); \
     lookup = (huff)->lookup[value]; \
-    bits = lookup >> LOOKUP_BITS; \
-    symbol = lookup & (1 << LOOKUP_BITS) - 1; \
-    XJPEG_SKIP_BITS(ctx, bits); \
+    bits = lookup >> 16; \
+    symbol = lookup & 0xff; \
     if (bits > LOOKUP_BITS) { \
-      value = ((ctx)->bitbuf >> (ctx)->bits) & ((1 << bits) - 1); \
-      while (value > (huff)->maxcode[bits - 1]) { \
-        int bit; \
-        XJPEG_DECODE_BITS(ctx, 1, bit); \
-        value = (value << 1) | bit; \
-        bits++; \
-      } \
-      symbol = (huff)->symbol[value + (huff)->index[bits - 1]]; \
+      XJPEG_PEEK_BITS(ctx, bits, value); \
+      lookup = (huff)->sub[(lookup & 0xffff) + \
+       (value & ((1 << (bits - LOOKUP_BITS)) - 1))]; \
+      bits = lookup >> 8; \
+      symbol = lookup & 0xff; \
     } \
-    XJPEG_LOG(("bits = %i, code = %02X, symbol = %02x\n", bits, \
-     value >> (LOOKUP_BITS - bits), symbol)); \
+    XJPEG_SKIP_BITS(ctx, bits); \
+    XJPEG_LOG(("bits = %i, symbol = %02x\n", bits, symbol)); \
   } \
   while (0)
 
@@ -195,7 +250,10 @@ static void printBits(int value, int bits) {
     int len; \
     XJPEG_DECODE_HUFF(ctx, huff, symbol); \
     len = symbol & 0xf; \
-    XJPEG_FILL_BITS(ctx); \
+    /* A 64-bit word always holds the at most 16 + 15 bits needed */ \
+    if (XJPEG_WORD_BITS < 64) { \
+      XJPEG_FILL_BITS(ctx); \
+    } \
     XJPEG_DECODE_BITS(ctx, len, value); \
     XJPEG_LOG(("len = %i\n", len)); \
     value += XJPEG_HUFF_EXTEND(value, len); \
@@ -204,6 +262,27 @@ static void printBits(int value, int bits) {
   } \
   while (0)
 
+/* Decode an AC symbol and coefficient value.
+   When the codeword and magnitude bits fit in LOOKUP_BITS this takes a single
+    lookup in ac_lookup, otherwise the symbol is decoded with XJPEG_DECODE_VLC.
+    */
+#define XJPEG_DECODE_AC(ctx, huff, symbol, value) \
+  do { \
+    int fast; \
+    XJPEG_FILL_BITS(ctx); \
+    XJPEG_PEEK_BITS(ctx, LOOKUP_BITS, fast); \
+    fast = (huff)->ac_lookup[fast]; \
+    if (fast) { \
+      XJPEG_SKIP_BITS(ctx, fast & 0xff); \
+      symbol = (fast >> 8) & 0xff; \
+      value = fast >> 16; \
+    } \
+    else { \
+      XJPEG_DECODE_VLC(ctx, huff, symbol, value); \
+    } \
+  } \
+  while (0)
+
 static void xjpeg_decode_soi(xjpeg_decode_ctx *ctx) {
   XJPEG_ERROR(ctx, ctx->start_of_image, "Error, already found SOI.");
   XJPEG_LOG(("Start of Image\n"));
@@ -213,7 +292,9 @@ static void xjpeg_decode_soi(xjpeg_decode_ctx *ctx) {
 static void xjpeg_decode_eoi(xjpeg_decode_ctx *ctx) {
   XJPEG_LOG(("End of Image\n"));
   ctx->end_of_image = 1;
-  XJPEG_ERROR(ctx, ctx->size != 0, "Error decoding EOI, unprocessed bytes.");
+  /* A stream is followed by its padding and the rest may not be pushed yet */
+  XJPEG_ERROR(ctx, ctx->size != 0 && ctx->stream == NULL,
+   "Error decoding EOI, unprocessed bytes.");
 }
 
 static void xjpeg_decode_dqt(xjpeg_decode_ctx *ctx) {
@@ -245,6 +326,7 @@ static void xjpeg_decode_dqt(xjpeg_decode_ctx *ctx) {
         XJPEG_DECODE_BYTE(ctx, quant->tbl[DE_ZIG_ZAG[i]]);
       }
     }
+    glj_real_idct8x8_prescale(quant->scaled, quant->tbl);
     len -= 65 + 64*pq;
 #if LOGGING_ENABLED
     for (i = 1; i <= 64; i++) {
@@ -308,30 +390,80 @@ static void xjpeg_decode_dht(xjpeg_decode_ctx *ctx) {
       XJPEG_ERROR(ctx, codeword >= 1 << i + 1, "Error invalid DHT.");
       codeword <<= 1;
     }
-    /* Generate a lookup table to speed up decoding */
+    /* Generate a lookup table to speed up decoding.
+       The first two entries of sub[] decode any invalid codeword, like
+        libjpeg, as symbol 0 after 16 bits. */
+    huff->sub[0] = huff->sub[1] = 16 << 8;
+    huff->nsub = 2;
     for (i = 0; i < 1 << LOOKUP_BITS; i++) {
-      huff->lookup[i] = (LOOKUP_BITS + 1) << LOOKUP_BITS;
+      huff->lookup[i] = (LOOKUP_BITS + 1) << 16;
     }
     k = 0;
     for (i = 1; i <= LOOKUP_BITS; i++) {
       for (j = 0; j < huff->nbits[i - 1]; j++) {
         codeword = huff->codeword[k] << (LOOKUP_BITS - i);
         for (l = 0; l < 1 << LOOKUP_BITS - i; l++) {
-          huff->lookup[codeword] = (i << LOOKUP_BITS) | huff->symbol[k];
+          huff->lookup[codeword] = (i << 16) | huff->symbol[k];
           codeword++;
         }
         k++;
       }
     }
-    /* Build an index into the codeword table and store the largest codeword
-        by bit in maxcode. */
-    k = 0;
-    for (i = 0; i < 16; i++) {
-      huff->maxcode[i] = -1;
-      if (huff->nbits[i]) {
-        huff->index[i] = k - huff->codeword[k];
-        k += huff->nbits[i];
-        huff->maxcode[i] = huff->codeword[k - 1];
+    /* Generate a second level table for each prefix of longer codewords.
+       Walking the codewords backwards, the first one seen with a prefix is
+        the longest and sets the size of the table. */
+    k = huff->nsymbs;
+    for (i = 16; i > LOOKUP_BITS; i--) {
+      for (j = 0; j < huff->nbits[i - 1]; j++) {
+        int prefix;
+        int bits;
+        k--;
+        prefix = (huff->codeword[k] >> (i - LOOKUP_BITS)) &
+         ((1 << LOOKUP_BITS) - 1);
+        bits = huff->lookup[prefix] >> 16;
+        if ((huff->lookup[prefix] & 0xffff) == 0) {
+          XJPEG_ERROR(ctx, huff->nsub + (1 << (i - LOOKUP_BITS)) > XJPEG_SUB_MAX,
+           "Error invalid DHT.");
+          if (huff->nsub + (1 << (i - LOOKUP_BITS)) > XJPEG_SUB_MAX) {
+            continue;
+          }
+          bits = i;
+          huff->lookup[prefix] = (bits << 16) | huff->nsub;
+          for (l = 0; l < 1 << (bits - LOOKUP_BITS); l++) {
+            huff->sub[huff->nsub++] = 16 << 8;
+          }
+        }
+        codeword = (huff->codeword[k] & ((1 << (i - LOOKUP_BITS)) - 1)) <<
+         (bits - i);
+        for (l = 0; l < 1 << (bits - i); l++) {
+          huff->sub[(huff->lookup[prefix] & 0xffff) + codeword] =
+           (i << 8) | huff->symbol[k];
+          codeword++;
+        }
+      }
+    }
+    /* For AC tables, generate a second lookup table that also decodes the
+        coefficient value when its magnitude bits fit in the lookup */
+    memset(huff->ac_lookup, 0, sizeof(huff->ac_lookup));
+    if (tc) {
+      k = 0;
+      for (i = 1; i <= LOOKUP_BITS; i++) {
+        for (j = 0; j < huff->nbits[i - 1]; j++) {
+          int len;
+          len = huff->symbol[k] & 0xf;
+          if (len && i + len <= LOOKUP_BITS) {
+            codeword = huff->codeword[k] << (LOOKUP_BITS - i);
+            for (l = 0; l < 1 << LOOKUP_BITS - i; l++) {
+              int value;
+              value = l >> (LOOKUP_BITS - i - len);
+              value += XJPEG_HUFF_EXTEND(value, len);
+              huff->ac_lookup[codeword] =
+               value*65536 + (huff->symbol[k] << 8) + i + len;
+              codeword++;
+            }
+          }
+          k++;
+        }
       }
     }
     /* If this is a DC table, validate that the symbols are between 0 and 15 */
@@ -344,10 +476,44 @@ static void xjpeg_decode_dht(xjpeg_decode_ctx *ctx) {
   XJPEG_ERROR(ctx, len != 0, "Error decoding DHT, unprocessed bytes.");
 }
 
+static void xjpeg_decode_dac(xjpeg_decode_ctx *ctx) {
+  unsigned short len;
+  XJPEG_DECODE_SHORT(ctx, len);
+  len -= 2;
+  while (len >= 2) {
+    unsigned char byte;
+    unsigned char tc;
+    unsigned char tb;
+    unsigned char cs;
+    XJPEG_DECODE_BYTE(ctx, byte);
+    tc = byte >> 4;
+    XJPEG_ERROR(ctx, tc > 1, "Error DAC expected Tc value 0 or 1.");
+    XJPEG_ERROR(ctx, (byte & 0xf) > 3, "Error DAC expected Tb value 0 to 3.");
+    tb = byte & 0x3;
+    XJPEG_DECODE_BYTE(ctx, cs);
+    XJPEG_LOG(("Reading Conditioning Table %i (%s) = %i\n", tb,
+     tc ? "AC" : "DC", cs));
+    if (tc) {
+      XJPEG_ERROR(ctx, cs < 1 || cs > 63,
+       "Error DAC expected Kx value 1 to 63.");
+      ctx->arith_ac_k[tb] = cs;
+    }
+    else {
+      XJPEG_ERROR(ctx, (cs & 0xf) > (cs >> 4),
+       "Error DAC expected L value no larger than U.");
+      ctx->arith_dc_l[tb] = cs & 0xf;
+      ctx->arith_dc_u[tb] = cs >> 4;
+    }
+    len -= 2;
+  }
+  XJPEG_ERROR(ctx, len != 0, "Error decoding DAC, unprocessed bytes.");
+}
+
 #define VSAMP_MAX (4)
 #define HSAMP_MAX (4)
 
-static void xjpeg_decode_sof(xjpeg_decode_ctx *ctx) {
+static void xjpeg_decode_sof(xjpeg_decode_ctx *ctx, int progressive,
+ int arithmetic) {
   unsigned short len;
   xjpeg_frame_header *frame;
   int i;
@@ -361,6 +527,8 @@ static void xjpeg_decode_sof(xjpeg_decode_ctx *ctx) {
   frame = &ctx->frame;
   XJPEG_ERROR(ctx, frame->valid, "Error multiple SOF not supported.");
   frame->valid = 1;
+  frame->progressive = progressive;
+  frame->arithmetic = arithmetic;
   XJPEG_DECODE_BYTE(ctx, frame->bits);
   XJPEG_DECODE_SHORT(ctx, frame->height);
   XJPEG_ERROR(ctx, frame->height == 0, "Error SOF has invalid height.");
@@ -399,6 +567,8 @@ static void xjpeg_decode_sof(xjpeg_decode_ctx *ctx) {
     len -= 3;
   }
   XJPEG_ERROR(ctx, len != 0, "Error decoding SOF, unprocessed bytes.");
+  frame->hmax = hmax;
+  frame->vmax = vmax;
   /* Compute the size in pixels of the MCU */
   mcu_width = hmax << 3;
   mcu_height = vmax << 3;
@@ -421,6 +591,41 @@ static void xjpeg_decode_rsi(xjpeg_decode_ctx *ctx) {
 
 typedef struct xjpeg_mcu xjpeg_mcu;
 
+/* The largest number of blocks in an MCU that will fit in the sampling factors
+    accepted by xjpeg_decode_sof(), the standard limits this to 10 */
+#define MCU_BLOCKS_MAX (NCOMPS_MAX*HSAMP_MAX*VSAMP_MAX)
+
+typedef struct xjpeg_mcu_offset xjpeg_mcu_offset;
+
+/* An offset into the coef, data and index arrays of an image_plane */
+struct xjpeg_mcu_offset {
+  int coef;
+  int data;
+  int index;
+};
+
+typedef struct xjpeg_mcu_block xjpeg_mcu_block;
+
+struct xjpeg_mcu_block {
+  /* The scan component this block belongs to */
+  int comp;
+  /* The position of the block relative to the first block of its component
+      in the MCU */
+  xjpeg_mcu_offset off;
+};
+
+typedef struct xjpeg_coef_block xjpeg_coef_block;
+
+/* A block of quantized coefficients decoded for yuv output whose
+    reconstruction is left to another thread, see xjpeg_decode_pipelined() */
+struct xjpeg_coef_block {
+  short coef[64];
+  const xjpeg_quant *quant;
+  int last;
+  unsigned char *data;
+  int ystride;
+};
+
 struct xjpeg_mcu {
   int nblocks[NCOMPS_MAX];
   xjpeg_huff *dc_huff[NCOMPS_MAX];
@@ -428,355 +633,3245 @@ struct xjpeg_mcu {
   xjpeg_quant *quant[NCOMPS_MAX];
   short dc_pred[NCOMPS_MAX];
   short *coef[NCOMPS_MAX];
+  /* The next free offset in the pack buffer */
+  int index;
+  /* The number of packed values written for each component */
+  int packed[NCOMPS_MAX];
+  /* The blocks of an MCU in the order they are coded, set by
+      xjpeg_mcu_blocks() */
+  int nblocks_mcu;
+  xjpeg_mcu_block block[MCU_BLOCKS_MAX];
+  /* The distance between vertically and horizontally adjacent MCUs for each
+      component */
+  xjpeg_mcu_offset row[NCOMPS_MAX];
+  xjpeg_mcu_offset col[NCOMPS_MAX];
+  /* When not NULL, the blocks of yuv output are only decoded, to the next
+      ndefer entries of defer, and not reconstructed */
+  xjpeg_coef_block *defer;
+  int ndefer;
 };
 
 static void xjpeg_mcu_init(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu) {
   int i;
   xjpeg_scan_comp *comp;
   memset(mcu->dc_pred, 0, sizeof(mcu->dc_pred));
+  memset(mcu->packed, 0, sizeof(mcu->packed));
+  mcu->index = 0;
+  mcu->defer = NULL;
+  mcu->ndefer = 0;
   for (i = 0, comp = ctx->scan.comp; i < ctx->scan.ncomps; i++, comp++) {
     xjpeg_comp_info *pi;
-    pi = &ctx->frame.comp[i];
-    mcu->nblocks[i] = pi->vsamp*pi->hsamp;
+    pi = &ctx->frame.comp[ctx->scan.comp[i].ci];
+    mcu->nblocks[i] = comp->vsamp*comp->hsamp;
     mcu->dc_huff[i] = &ctx->dc_huff[comp->td];
     mcu->ac_huff[i] = &ctx->ac_huff[comp->ta];
     mcu->quant[i] = &ctx->quant[pi->tq];
   }
 }
 
-/* TODO Refactor this function so that we can switch on out before reaching
-   the inner loop */
-static void xjpeg_decode_scan(xjpeg_decode_ctx *ctx, short *pack,
- image_plane *plane[NPLANES_MAX], xjpeg_decode_out out) {
-  int mcu_counter;
-  int rst_counter;
-  xjpeg_mcu mcu;
-  int mbx;
-  int mby;
-  int index;
-  mcu_counter = ctx->restart_interval;
-  rst_counter = 0;
-  xjpeg_mcu_init(ctx, &mcu);
-  index = 0;
-  for (mby = 0; mby < ctx->frame.nvmb; mby++) {
-    for (mbx = 0; mbx < ctx->frame.nhmb; mbx++) {
-      int i;
-      for (i = 0; i < ctx->scan.ncomps; i++) {
-        xjpeg_comp_info *pi;
-        image_plane *ip;
-        int sby;
-        int sbx;
-        pi = &ctx->frame.comp[i];
-        ip = plane[i];
-        for (sby = 0; sby < pi->vsamp; sby++) {
-          for (sbx = 0; sbx < pi->hsamp; sbx++) {
-            short block[64];
-            unsigned char symbol;
-            short value;
-            int j;
-            memset(block, 0, sizeof(block));
-            XJPEG_DECODE_VLC(ctx, mcu.dc_huff[i], symbol, value);
-            XJPEG_LOG(("dc = %i\n", value));
-            mcu.dc_pred[i] += value;
-            XJPEG_LOG(("dc_pred = %i\n", pred[i]));
-            j = 0;
-            switch (out) {
-              case XJPEG_DECODE_PACK : {
-                int by;
-                int bx;
-                by = (mby*pi->vsamp + sby);
-                bx = (mbx*pi->hsamp + sbx);
-                /*printf("i = %i, by = %i, bx = %i, o = %i, y_stride = %i, index = %i\n",
-                 i, by, bx, by*(ip->ystride >>3) + bx, ip->ystride, index);*/
-                ip->index[by*(ip->ystride >> 3) + bx] = index;
-                ip->packed++;
-                pack[index] = mcu.dc_pred[i] & 0xfff;
-                /*printf("DC = %x, pack = %x, run = %i, value = %i\n", mcu.dc_pred[i], pack[index], pack[index] >> 12, (pack[index] & 0xfff) | (pack[index] & 0x800 == 0x800 ? ~0xfff : 0));*/
-                index++;
-              }
-              case XJPEG_DECODE_QUANT : {
-                block[0] = mcu.dc_pred[i];
-                break;
-              }
-              default : {
-                block[0] = mcu.dc_pred[i]*mcu.quant[i]->tbl[0];
-              }
-            }
-            do {
-              XJPEG_DECODE_VLC(ctx, mcu.ac_huff[i], symbol, value);
-              if (symbol) {
-                j += (symbol >> 4) + 1;
-                XJPEG_LOG(("j = %i, offset = %i, value = %i, dequant = %i\n", j,
-                 (symbol >> 4) + 1, value, value*mcu.quant[i]->tbl[j]));
-                XJPEG_ERROR(ctx, j > 63, "Error indexing outside block.");
-                switch (out) {
-                  case XJPEG_DECODE_PACK : {
-                    ip->packed++;
-                    pack[index] = (((symbol >> 4) & 0xf) << 12) | (value & 0xfff);
-                    /*printf("run = %i, value = %i, pack = %x, run = %i, value = %i\n", (symbol >> 4) & 0xf, (value & 0xfff), pack[index], pack[index] >> 12, (pack[index] & 0xfff) | ((pack[index] & 0x800) == 0x800 ? (unsigned int)~0xfff : 0));*/
-                    index++;
-                    break;
-                  }
-                  case XJPEG_DECODE_QUANT : {
-                    block[DE_ZIG_ZAG[j]] = value;
-                    break;
-                  }
-                  default : {
-                    block[DE_ZIG_ZAG[j]] =
-                     value*mcu.quant[i]->tbl[DE_ZIG_ZAG[j]];
-                  }
-                }
-              }
-              else {
-                if (out == XJPEG_DECODE_PACK) {
-                  ip->packed++;
-                  pack[index] = 0;
-                  index++;
-                }
-                XJPEG_LOG(("****************** EOB at j = %i\n\n", j));
-                break;
-              }
-            }
-            while (j < 63);
-#if LOGGING_ENABLED
-            for (j = 1; j <= 64; j++) {
-              XJPEG_LOG("%5i%s", block[j - 1], j & 0x7 ? ", " : "\n");
-            }
-#endif
-            switch (out) {
-              case XJPEG_DECODE_PACK : {
-                break;
-              }
-              case XJPEG_DECODE_QUANT :
-              case XJPEG_DECODE_DCT : {
-                int by;
-                int bx;
-                int off;
-                short *coef;
-                by = (mby*pi->vsamp + sby);
-                bx = (mbx*pi->hsamp + sbx);
-                off = (plane[0]->width<<3)*(by>>ip->xdec) +
-                 (plane[0]->width << 3 >> ip->xdec)*(by & ((1<<ip->xdec) - 1)) +
-                 (bx<<6);
-                coef = ip->coef + off;
-                memcpy(coef, block, sizeof(block));
-                break;
-              }
-              case XJPEG_DECODE_YUV : {
-                unsigned char *data;
-                short *b;
-                int k;
-                glj_real_idct8x8(block, 8, block, 8);
-                data = ip->data +
-                 ((mby*pi->vsamp + sby)*ip->ystride << 3) +
-                 ((mbx*pi->hsamp + sbx)*ip->xstride << 3);
-                b = block;
-                for (k = 0; k < 8; k++) {
-                  unsigned char *row;
-                  row = data;
-                  for (j = 0; j < 8; j++) {
-                    *row = GLJ_CLAMP255(*b + 128);
-                    row++;
-                    b++;
-                  }
-                  data += ip->ystride;
-                }
-                break;
-              }
-              default : {
-                fprintf(stderr, "Unsupported output %i\n", out);
-              }
-            }
-          }
-        }
-      }
-      mcu_counter--;
-      XJPEG_LOG(("mbx = %i, mby = %i, rst_counter = %i, mcu_counter = %i\n",
-       mbx, mby, rst_counter, mcu_counter));
-      if (ctx->restart_interval && mcu_counter == 0) {
-        XJPEG_ERROR(ctx, ctx->pos[0] != 0xFF, "Error, invalid JPEG syntax.");
-        XJPEG_SKIP_BYTES(ctx, 1);
-        XJPEG_DECODE_BYTE(ctx, ctx->marker);
-        XJPEG_ERROR(ctx, !ctx->marker, "Error, expected to find marker.");
-        switch (ctx->marker) {
-          case 0xD0 :
-          case 0xD1 :
-          case 0xD2 :
-          case 0xD3 :
-          case 0xD4 :
-          case 0xD5 :
-          case 0xD6 :
-          case 0xD7 : {
-            XJPEG_ERROR(ctx, (ctx->marker & 0x7) != (rst_counter & 0x7),
-              "Error invalid RST counter in marker.");
-            ctx->marker = 0;
-            ctx->bits = 0;
-            mcu_counter = ctx->restart_interval;
-            rst_counter++;
-            for (i = 0; i < ctx->scan.ncomps; i++) {
-              mcu.dc_pred[i] = 0;
-            }
-            break;
-          }
-          /* End of Image */
-          case 0xD9 : {
-            return;
-          }
-          default : {
-            XJPEG_ERROR(ctx, 1, "Error, unknown marker found in scan.");
-          }
-        }
+/* Precompute where each block of an MCU is written in the image planes, so
+    the MCU loop only adds the position of the MCU.
+   The planes only hold the crop region, so the offsets are relative to the
+    position its first MCU would have. */
+static void xjpeg_mcu_blocks(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu,
+ image_plane *plane[NPLANES_MAX]) {
+  const xjpeg_region *crop;
+  int i;
+  crop = &ctx->scan.crop;
+  mcu->nblocks_mcu = 0;
+  for (i = 0; i < ctx->scan.ncomps; i++) {
+    xjpeg_scan_comp *comp;
+    image_plane *ip;
+    xjpeg_mcu_offset base;
+    int sby;
+    int sbx;
+    comp = &ctx->scan.comp[i];
+    ip = plane[i];
+    mcu->row[i].coef = comp->vsamp*(ip->width << (3 + ctx->scale));
+    mcu->row[i].data = comp->vsamp*ip->ystride << (3 - ctx->scale);
+    mcu->row[i].index = comp->vsamp*(ip->ystride >> 3);
+    mcu->col[i].coef = comp->hsamp << 6;
+    mcu->col[i].data = comp->hsamp*ip->xstride << (3 - ctx->scale);
+    mcu->col[i].index = comp->hsamp;
+    base.coef = crop->y0*mcu->row[i].coef + crop->x0*mcu->col[i].coef;
+    base.data = crop->y0*mcu->row[i].data + crop->x0*mcu->col[i].data;
+    base.index = crop->y0*mcu->row[i].index + crop->x0*mcu->col[i].index;
+    for (sby = 0; sby < comp->vsamp; sby++) {
+      for (sbx = 0; sbx < comp->hsamp; sbx++) {
+        xjpeg_mcu_block *mb;
+        mb = &mcu->block[mcu->nblocks_mcu++];
+        mb->comp = i;
+        mb->off.coef = sby*(ip->width << (3 + ctx->scale)) + (sbx << 6) -
+         base.coef;
+        mb->off.data = (sby*ip->ystride << (3 - ctx->scale)) +
+         (sbx*ip->xstride << (3 - ctx->scale)) - base.data;
+        mb->off.index = sby*(ip->ystride >> 3) + sbx - base.index;
       }
     }
   }
 }
 
-static void xjpeg_decode_sos(xjpeg_decode_ctx *ctx, image *img,
- xjpeg_decode_out out) {
-  unsigned short len;
-  xjpeg_scan_header *scan;
-  int i, j;
-  image_plane *plane[NPLANES_MAX];
-  unsigned char byte;
-  XJPEG_DECODE_SHORT(ctx, len);
-  len -= 2;
-  XJPEG_ERROR(ctx, len < 6, "Error SOS needs at least 6 bytes");
-  scan = &ctx->scan;
-  XJPEG_ERROR(ctx, scan->valid, "Error multiple SOS not supported.");
-  scan->valid = 1;
-  XJPEG_DECODE_BYTE(ctx, scan->ncomps);
-  XJPEG_ERROR(ctx, scan->ncomps == 0 || scan->ncomps > 4,
-   "Error SOS expected Ns value 1 to 4.");
-  len--;
-  XJPEG_ERROR(ctx, scan->ncomps != 1 && scan->ncomps != 3,
-   "Error only scans with 1 or 3 components supported");
-  for (i = 0; i < scan->ncomps; i++) {
-    xjpeg_scan_comp *comp;
-    comp = &scan->comp[i];
-    XJPEG_DECODE_BYTE(ctx, comp->id);
-    plane[i] = NULL;
-    for (j = 0; j < ctx->frame.ncomps; j++) {
-      if (ctx->frame.comp[j].id == comp->id) {
-        plane[i] = &img->plane[j];
-        break;
-      }
+/* Level shift and clamp an nxn block of samples into data. */
+static void xjpeg_store_samples(const short *block, int n, unsigned char *data,
+ int ystride) {
+  int k;
+  int j;
+  for (k = 0; k < n; k++) {
+    for (j = 0; j < n; j++) {
+      data[j] = GLJ_CLAMP255(block[k*n + j] + 128);
     }
-    XJPEG_ERROR(ctx, !plane[i], "Error SOS references invalid component.");
-    XJPEG_DECODE_BYTE(ctx, byte);
-    comp->td = byte >> 4;
-    XJPEG_ERROR(ctx, !ctx->dc_huff[comp->td].valid,
-     "Error SOS component references invalid DC entropy table.");
-    comp->ta = byte & 0x7;
-    XJPEG_ERROR(ctx, !ctx->ac_huff[comp->ta].valid,
-     "Error SOS component references invalid AC entropy table.");
-    len -= 2;
+    data += ystride;
   }
-  XJPEG_DECODE_BYTE(ctx, byte);
-  XJPEG_ERROR(ctx, byte != 0, "Error SOS expected Ss value 0.");
-  XJPEG_DECODE_BYTE(ctx, byte);
-  XJPEG_ERROR(ctx, byte != 63, "Error SOS expected Se value 0.");
-  XJPEG_DECODE_BYTE(ctx, byte);
-  XJPEG_ERROR(ctx, byte >> 4 != 0, "Error SOS expected Ah value 0.");
-  XJPEG_ERROR(ctx, byte & 0x7 != 0, "Error SOS expected Al value 0.");
-  len -= 3;
-  XJPEG_ERROR(ctx, len != 0, "Error decoding SOS, unprocessed bytes.");
-  switch (out) {
-    case XJPEG_DECODE_PACK :
-    case XJPEG_DECODE_QUANT :
-    case XJPEG_DECODE_DCT :
-    case XJPEG_DECODE_YUV : {
-      xjpeg_decode_scan(ctx, img->coef, plane, out);
+}
+
+/* Dequantize and reconstruct a block of coefficients and store its samples,
+    scaled down by 2^ctx->scale in each direction.
+   Every coefficient after zig-zag index last is zero, which selects the
+    cheapest inverse DCT that gives the same samples. */
+static void xjpeg_store_block(xjpeg_decode_ctx *ctx, short block[64],
+ const xjpeg_quant *quant, int last, unsigned char *data, int ystride) {
+  int scale;
+  int n;
+  int k;
+  int j;
+  for (k = 0; k <= last; k++) {
+    j = DE_ZIG_ZAG[k];
+    block[j] = block[j]*quant->tbl[j];
+  }
+  scale = ctx->scale;
+  n = 8 >> scale;
+  if (last == 0 && scale < 2) {
+    if (scale == 0 && ctx->idct == XJPEG_IDCT_ISLOW) {
+      glj_islow_idct8x8_dc(block, block);
+    }
+    else {
+      glj_real_idct8x8_dc(block, block);
+    }
+    j = GLJ_CLAMP255(block[0] + 128);
+    for (k = 0; k < n; k++) {
+      memset(data, j, n);
+      data += ystride;
+    }
+    return;
+  }
+  switch (scale) {
+    case 0 : {
+      /* Zig-zag indices 0 to 2 are in the top-left 2x2 coefficients and 0 to
+          9 in the top-left 4x4 */
+      if (ctx->idct == XJPEG_IDCT_ISLOW) {
+        GLJ_ISLOW_IDCT8X8(block, 8, block, 8);
+      }
+      else if (last <= 2) {
+        glj_real_idct8x8_2x2(block, 8, block, 8);
+      }
+      else if (last <= 9) {
+        glj_real_idct8x8_4x4(block, 8, block, 8);
+      }
+      else {
+        glj_real_idct8x8(block, 8, block, 8);
+      }
+      break;
+    }
+    case 1 : {
+      glj_real_idct4x4(block, 4, block, 8);
+      break;
+    }
+    case 2 : {
+      glj_real_idct2x2(block, 2, block, 8);
       break;
     }
     default : {
-      XJPEG_ERROR(ctx, 1, "Error, unsupported output format.");
+      glj_real_idct1x1(block, block);
     }
   }
+  xjpeg_store_samples(block, n, data, ystride);
 }
 
-static void xjpeg_skip_marker(xjpeg_decode_ctx *ctx) {
-  unsigned short len;
-  XJPEG_DECODE_SHORT(ctx, len);
-  XJPEG_LOG(("Skipping %i bytes\n", len - 2));
-  XJPEG_SKIP_BYTES(ctx, len - 2);
+typedef struct xjpeg_block_queue xjpeg_block_queue;
+
+/* Blocks that need the full float inverse DCT, which are dequantized and
+    reconstructed GLJ_IDCT_BATCH_MAX at a time by glj_real_idct8x8_store() */
+struct xjpeg_block_queue {
+  int nblocks;
+  /* Storage for the blocks of callers that decode into the queue */
+  short block[GLJ_IDCT_BATCH_MAX][64];
+  const short *coef[GLJ_IDCT_BATCH_MAX];
+  const float *scaled[GLJ_IDCT_BATCH_MAX];
+  unsigned char *data[GLJ_IDCT_BATCH_MAX];
+  int ystride[GLJ_IDCT_BATCH_MAX];
+};
+
+static void xjpeg_flush_blocks(xjpeg_block_queue *queue) {
+  if (queue->nblocks == 0) {
+    return;
+  }
+  glj_real_idct8x8_store(queue->data, queue->ystride, queue->coef,
+   queue->scaled, queue->nblocks);
+  queue->nblocks = 0;
 }
 
-static void xjpeg_decode(xjpeg_decode_ctx *ctx, int headers_only, image *img,
- xjpeg_decode_out out) {
-  while (!ctx->error && !ctx->end_of_image) {
-    unsigned char marker;
-    marker = ctx->marker;
-    ctx->marker = 0;
-    if (marker == 0) {
-      XJPEG_ERROR(ctx, ctx->size < 2, "Error underflow reading marker.");
-      XJPEG_ERROR(ctx, ctx->pos[0] != 0xFF, "Error, invalid JPEG syntax.");
-      XJPEG_SKIP_BYTES(ctx, 1);
-      XJPEG_DECODE_BYTE(ctx, marker);
-    }
-    if (headers_only && marker == 0xDA) {
-      ctx->marker = marker;
+/* As xjpeg_store_block(), but a block that takes the full float inverse DCT
+    is queued instead, so it must not change until the queue is flushed.
+   The queue must be flushed before the samples are used. */
+static void xjpeg_queue_block(xjpeg_decode_ctx *ctx, xjpeg_block_queue *queue,
+ short block[64], const xjpeg_quant *quant, int last, unsigned char *data,
+ int ystride) {
+  int n;
+  n = queue->nblocks;
+  if (ctx->scale != 0 || ctx->idct != XJPEG_IDCT_FLOAT || last <= 9) {
+    xjpeg_store_block(ctx, block, quant, last, data, ystride);
+    return;
+  }
+  queue->coef[n] = block;
+  queue->scaled[n] = quant->scaled;
+  queue->data[n] = data;
+  queue->ystride[n] = ystride;
+  queue->nblocks = n + 1;
+  if (queue->nblocks == GLJ_IDCT_BATCH_MAX) {
+    xjpeg_flush_blocks(queue);
+  }
+}
+
+#define XJPEG_PASTE_(a, b) a ## b
+#define XJPEG_PASTE(a, b) XJPEG_PASTE_(a, b)
+
+#define XJPEG_MCUS_NAME xjpeg_decode_mcus_pack
+#define XJPEG_MCUS_OUT XJPEG_DECODE_PACK
+#include "xjpeg_mcus.h"
+
+#define XJPEG_MCUS_NAME xjpeg_decode_mcus_quant
+#define XJPEG_MCUS_OUT XJPEG_DECODE_QUANT
+#include "xjpeg_mcus.h"
+
+#define XJPEG_MCUS_NAME xjpeg_decode_mcus_dct
+#define XJPEG_MCUS_OUT XJPEG_DECODE_DCT
+#include "xjpeg_mcus.h"
+
+#define XJPEG_MCUS_NAME xjpeg_decode_mcus_yuv
+#define XJPEG_MCUS_OUT XJPEG_DECODE_YUV
+#include "xjpeg_mcus.h"
+
+/* Step over the AC coefficients of a block, reading only their codes to
+    find how many magnitude bits follow. */
+static void xjpeg_skip_ac(xjpeg_decode_ctx *ctx, xjpeg_huff *huff) {
+  unsigned char symbol;
+  int j;
+  j = 0;
+  do {
+    XJPEG_DECODE_HUFF(ctx, huff, symbol);
+    if (!symbol) {
       break;
     }
-    XJPEG_LOG(("Marker %02X\n", marker));
-    switch (marker) {
-      /* Start of Image */
-      case 0xD8 : {
-        xjpeg_decode_soi(ctx);
-        break;
-      }
-      /* End of Image */
-      case 0xD9 : {
-        xjpeg_decode_eoi(ctx);
-        break;
-      }
-      /* Quantization Tables */
-      case 0xDB : {
-        xjpeg_decode_dqt(ctx);
-        break;
-      }
-      /* Huffman Tables */
-      case 0xC4 : {
-        xjpeg_decode_dht(ctx);
-        break;
-      }
-      /* Start of Frame (SOF0 Baseline DCT) */
-      case 0xC0 : {
-        xjpeg_decode_sof(ctx);
-        break;
-      }
-      /* Restart Interval */
-      case 0xDD : {
-        xjpeg_decode_rsi(ctx);
-        break;
-      }
-      /* Start of Scans */
-      case 0xDA : {
-        xjpeg_decode_sos(ctx, img, out);
-        break;
-      }
-      default : {
-        xjpeg_skip_marker(ctx);
-        break;
-      }
+    j += (symbol >> 4) + 1;
+    XJPEG_FILL_BITS(ctx);
+    XJPEG_SKIP_BITS(ctx, symbol & 0xf);
+  }
+  while (j < 63);
+}
+
+/* Decode the symbols of one MCU without producing any output, only tracking
+    the DC predictors. */
+static void xjpeg_skip_mcu(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu) {
+  int i;
+  for (i = 0; i < ctx->scan.ncomps; i++) {
+    int k;
+    for (k = 0; k < mcu->nblocks[i]; k++) {
+      unsigned char symbol;
+      short value;
+      XJPEG_DECODE_VLC(ctx, mcu->dc_huff[i], symbol, value);
+      mcu->dc_pred[i] += value;
+      xjpeg_skip_ac(ctx, mcu->ac_huff[i]);
     }
   }
 }
 
-void xjpeg_decode_header(xjpeg_decode_ctx *ctx) {
-  xjpeg_decode(ctx, 1, NULL, (xjpeg_decode_out)0);
+/* Decode the MCUs in [start, end) to an image scaled down by 8, where each
+    block is a single sample given by its DC coefficient.
+   The AC coefficients are skipped without being stored, so no block is
+    cleared, dequantized or transformed. */
+static void xjpeg_decode_mcus_dc(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu,
+ image_plane *plane[NPLANES_MAX], int start, int end) {
+  int m;
+  for (m = start; m < end; m++) {
+    int mbx;
+    int mby;
+    int data_off[NCOMPS_MAX];
+    int n;
+    int i;
+    mby = m/ctx->scan.nhmb;
+    mbx = m - mby*ctx->scan.nhmb;
+    for (i = 0; i < ctx->scan.ncomps; i++) {
+      data_off[i] = mby*mcu->row[i].data + mbx*mcu->col[i].data;
+    }
+    for (n = 0; n < mcu->nblocks_mcu; n++) {
+      xjpeg_mcu_block *mb;
+      short dc;
+      unsigned char symbol;
+      short value;
+      mb = &mcu->block[n];
+      i = mb->comp;
+      XJPEG_DECODE_VLC(ctx, mcu->dc_huff[i], symbol, value);
+      mcu->dc_pred[i] += value;
+      xjpeg_skip_ac(ctx, mcu->ac_huff[i]);
+      dc = mcu->dc_pred[i]*mcu->quant[i]->tbl[0];
+      glj_real_idct1x1(&dc, &dc);
+      plane[i]->data[data_off[i] + mb->off.data] = GLJ_CLAMP255(dc + 128);
+    }
+  }
 }
 
-void xjpeg_decode_image(xjpeg_decode_ctx *ctx, image *img,
- xjpeg_decode_out out) {
-  xjpeg_decode(ctx, 0, img, out);
+/* Return non-zero if only part of the scan is decoded to the image. */
+static int xjpeg_cropped(const xjpeg_scan_header *scan) {
+  return scan->crop.x0 != 0 || scan->crop.y0 != 0 ||
+   scan->crop.x1 != scan->nhmb || scan->crop.y1 != scan->nvmb;
 }
 
-void xjpeg_init(xjpeg_decode_ctx *ctx, const unsigned char *buf, int size) {
-  memset(ctx, 0, sizeof(xjpeg_decode_ctx));
-  ctx->pos = buf;
-  ctx->size = size;
+/* Return the number of MCUs in [0, m) of the scan that are inside the crop
+    region. */
+static int xjpeg_crop_count(const xjpeg_scan_header *scan, int m) {
+  const xjpeg_region *crop;
+  int mby;
+  int mbx;
+  int n;
+  crop = &scan->crop;
+  mby = m/scan->nhmb;
+  mbx = m - mby*scan->nhmb;
+  n = (GLJ_MINI(GLJ_MAXI(mby, crop->y0), crop->y1) - crop->y0)*
+   (crop->x1 - crop->x0);
+  if (mby >= crop->y0 && mby < crop->y1) {
+    n += GLJ_MINI(GLJ_MAXI(mbx, crop->x0), crop->x1) - crop->x0;
+  }
+  return n;
+}
+
+/* Return the index just past the last MCU of the scan inside the crop
+    region, after which the rest of the scan need not be decoded. */
+static int xjpeg_crop_end(const xjpeg_scan_header *scan) {
+  return (scan->crop.y1 - 1)*scan->nhmb + scan->crop.x1;
+}
+
+/* Decode the MCUs in [start, end), selecting the loop for out once rather
+    than for every coefficient. */
+static void xjpeg_decode_mcus_out(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu,
+ short *pack, image_plane *plane[NPLANES_MAX], xjpeg_decode_out out,
+ int start, int end) {
+  switch (out) {
+    case XJPEG_DECODE_PACK : {
+      xjpeg_decode_mcus_pack(ctx, mcu, pack, plane, start, end);
+      break;
+    }
+    case XJPEG_DECODE_QUANT : {
+      xjpeg_decode_mcus_quant(ctx, mcu, pack, plane, start, end);
+      break;
+    }
+    case XJPEG_DECODE_DCT : {
+      xjpeg_decode_mcus_dct(ctx, mcu, pack, plane, start, end);
+      break;
+    }
+    case XJPEG_DECODE_YUV : {
+      if (ctx->scale == 3) {
+        xjpeg_decode_mcus_dc(ctx, mcu, plane, start, end);
+        break;
+      }
+      xjpeg_decode_mcus_yuv(ctx, mcu, pack, plane, start, end);
+      break;
+    }
+    default : {
+      fprintf(stderr, "Unsupported output %i\n", out);
+    }
+  }
+}
+
+/* Decode the MCUs in [start, end).
+   The MCUs outside the crop region are only entropy decoded, to find where
+    the next one starts and track the DC predictors. */
+static void xjpeg_decode_mcus(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu,
+ short *pack, image_plane *plane[NPLANES_MAX], xjpeg_decode_out out,
+ int start, int end) {
+  const xjpeg_region *crop;
+  int m;
+  if (!xjpeg_cropped(&ctx->scan)) {
+    xjpeg_decode_mcus_out(ctx, mcu, pack, plane, out, start, end);
+    return;
+  }
+  crop = &ctx->scan.crop;
+  for (m = start; m < end && !ctx->error; ) {
+    int mby;
+    int mbx;
+    int row;
+    int next;
+    mby = m/ctx->scan.nhmb;
+    mbx = m - mby*ctx->scan.nhmb;
+    row = m - mbx;
+    if (mby >= crop->y0 && mby < crop->y1 && mbx >= crop->x0 &&
+     mbx < crop->x1) {
+      next = GLJ_MINI(row + crop->x1, end);
+      xjpeg_decode_mcus_out(ctx, mcu, pack, plane, out, m, next);
+      m = next;
+      continue;
+    }
+    next = row + ctx->scan.nhmb;
+    if (mby >= crop->y0 && mby < crop->y1 && mbx < crop->x0) {
+      next = row + crop->x0;
+    }
+    for (next = GLJ_MINI(next, end); m < next && !ctx->error; m++) {
+      xjpeg_skip_mcu(ctx, mcu);
+    }
+  }
+}
+
+/* The number of rows of MCUs in the ring of xjpeg_decode_pipelined() for
+    each of its threads */
+#define XJPEG_PIPE_ROWS (2)
+
+typedef struct xjpeg_pipe xjpeg_pipe;
+
+struct xjpeg_pipe {
+  xjpeg_decode_ctx *ctx;
+  xjpeg_mcu *mcu;
+  image_plane **plane;
+  int start;
+  int end;
+  glj_ring *ring;
+  /* The blocks of each slot of the ring and the number decoded to it */
+  xjpeg_coef_block *block;
+  int *nblocks;
+  int row_blocks;
+};
+
+/* Reconstruct the blocks of a filled slot of the ring and free it. */
+static void xjpeg_pipe_store(xjpeg_pipe *pipe, int slot) {
+  xjpeg_block_queue queue;
+  xjpeg_coef_block *cb;
+  int k;
+  queue.nblocks = 0;
+  cb = pipe->block + (size_t)slot*pipe->row_blocks;
+  for (k = 0; k < pipe->nblocks[slot]; k++, cb++) {
+    xjpeg_queue_block(pipe->ctx, &queue, cb->coef, cb->quant, cb->last,
+     cb->data, cb->ystride);
+  }
+  xjpeg_flush_blocks(&queue);
+  glj_ring_release(pipe->ring, slot);
+}
+
+/* Task 0 entropy decodes the MCUs a row at a time into the ring, the others
+    reconstruct the rows it fills until it is done. */
+static void xjpeg_pipe_task(void *ctx, int thread, int task) {
+  xjpeg_pipe *pipe;
+  int slot;
+  (void)thread;
+  pipe = (xjpeg_pipe *)ctx;
+  if (task == 0) {
+    int nhmb;
+    int next;
+    int m;
+    nhmb = pipe->ctx->scan.nhmb;
+    for (m = pipe->start; m < pipe->end && !pipe->ctx->error; m = next) {
+      int filled;
+      next = GLJ_MINI((m/nhmb + 1)*nhmb, pipe->end);
+      for (;;) {
+        slot = glj_ring_acquire(pipe->ring, &filled);
+        if (!filled) {
+          break;
+        }
+        xjpeg_pipe_store(pipe, slot);
+      }
+      pipe->mcu->defer = pipe->block + (size_t)slot*pipe->row_blocks;
+      pipe->mcu->ndefer = 0;
+      xjpeg_decode_mcus(pipe->ctx, pipe->mcu, NULL, pipe->plane,
+       XJPEG_DECODE_YUV, m, next);
+      pipe->nblocks[slot] = pipe->mcu->ndefer;
+      glj_ring_push(pipe->ring, slot);
+    }
+    pipe->mcu->defer = NULL;
+    glj_ring_close(pipe->ring);
+  }
+  while ((slot = glj_ring_pop(pipe->ring)) >= 0) {
+    xjpeg_pipe_store(pipe, slot);
+  }
+}
+
+/* Decode the MCUs in [start, end) to yuv on nthreads threads, one of which
+    entropy decodes them a row at a time into a bounded ring while the others
+    dequantize, transform and store the rows it has filled.
+   Entropy decoding is inherently serial, but this leaves it as all that one
+    thread does, even in a scan with no restart markers.
+   Returns EXIT_FAILURE without decoding anything if the ring or the threads
+    cannot be set up, in which case the caller decodes serially. */
+static int xjpeg_decode_pipelined(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu,
+ image_plane *plane[NPLANES_MAX], int start, int end, int nthreads) {
+  xjpeg_pipe pipe;
+  int nslots;
+  int ret;
+  nslots = XJPEG_PIPE_ROWS*nthreads;
+  pipe.row_blocks = (ctx->scan.crop.x1 - ctx->scan.crop.x0)*mcu->nblocks_mcu;
+  pipe.block = (xjpeg_coef_block *)malloc(
+   (size_t)nslots*pipe.row_blocks*sizeof(xjpeg_coef_block));
+  pipe.nblocks = (int *)malloc(nslots*sizeof(int));
+  pipe.ring = glj_ring_create(nslots);
+  if (pipe.block == NULL || pipe.nblocks == NULL || pipe.ring == NULL) {
+    glj_ring_destroy(pipe.ring);
+    free(pipe.nblocks);
+    free(pipe.block);
+    return EXIT_FAILURE;
+  }
+  pipe.ctx = ctx;
+  pipe.mcu = mcu;
+  pipe.plane = plane;
+  pipe.start = start;
+  pipe.end = end;
+  ret = glj_run_tasks(xjpeg_pipe_task, &pipe, nthreads, nthreads);
+  glj_ring_destroy(pipe.ring);
+  free(pipe.nblocks);
+  free(pipe.block);
+  return ret;
+}
+
+/* Consume the marker expected at the end of a restart interval.
+   On RSTn the bit reader and DC predictors are reset, on EOI the marker is
+    left in ctx->marker for xjpeg_decode() to process. */
+static void xjpeg_decode_rst(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu,
+ int rst_counter) {
+  (void)rst_counter;
+  XJPEG_ERROR(ctx, ctx->pos[0] != 0xFF, "Error, invalid JPEG syntax.");
+  XJPEG_SKIP_BYTES(ctx, 1);
+  XJPEG_DECODE_BYTE(ctx, ctx->marker);
+  XJPEG_ERROR(ctx, !ctx->marker, "Error, expected to find marker.");
+  switch (ctx->marker) {
+    case 0xD0 :
+    case 0xD1 :
+    case 0xD2 :
+    case 0xD3 :
+    case 0xD4 :
+    case 0xD5 :
+    case 0xD6 :
+    case 0xD7 : {
+      XJPEG_ERROR(ctx, (ctx->marker & 0x7) != (rst_counter & 0x7),
+        "Error invalid RST counter in marker.");
+      ctx->marker = 0;
+      ctx->bits = 0;
+      memset(mcu->dc_pred, 0, sizeof(mcu->dc_pred));
+      break;
+    }
+    /* End of Image */
+    case 0xD9 : {
+      break;
+    }
+    default : {
+      XJPEG_ERROR(ctx, 1, "Error, unknown marker found in scan.");
+    }
+  }
+}
+
+/* Discard the bits left over at the end of a scan.
+   The bit reader never reads past a marker, so this leaves pos at the marker
+    following the scan for xjpeg_decode() to process. */
+static void xjpeg_end_scan(xjpeg_decode_ctx *ctx) {
+  ctx->bitbuf = 0;
+  ctx->bits = 0;
+  ctx->marker = 0;
+  while (ctx->size > 2 && ctx->pos[0] == 0xFF && ctx->pos[1] == 0xFF) {
+    XJPEG_SKIP_BYTES(ctx, 1);
+  }
+}
+
+/* Find the RSTn markers in the entropy coded segment that begins at pos.
+   The address just past each of the first nrst markers is stored in rst and
+    end is set to the first marker that is not a RSTn.
+   Returns the number of RSTn markers found. */
+static int xjpeg_find_rst(const unsigned char *pos, int size,
+ const unsigned char **rst, int nrst, const unsigned char **end) {
+  const unsigned char *p;
+  const unsigned char *q;
+  int n;
+  n = 0;
+  p = pos;
+  q = pos + size;
+  *end = q;
+  while (p < q - 1) {
+    p = memchr(p, 0xFF, q - 1 - p);
+    if (p == NULL) {
+      break;
+    }
+    if (p[1] == 0x00 || p[1] == 0xFF) {
+      p++;
+      continue;
+    }
+    if ((p[1] & 0xF8) != 0xD0) {
+      *end = p;
+      break;
+    }
+    if (n < nrst) {
+      rst[n] = p + 2;
+    }
+    n++;
+    p += 2;
+  }
+  return n;
+}
+
+/* Move past the rest of the entropy coded data of the scan without decoding
+    it, to the next marker that is not a RSTn. */
+static void xjpeg_skip_scan(xjpeg_decode_ctx *ctx) {
+  const unsigned char *next;
+  xjpeg_find_rst(ctx->pos, ctx->size, NULL, 0, &next);
+  ctx->size -= next - ctx->pos;
+  ctx->pos = next;
+  xjpeg_end_scan(ctx);
+}
+
+/* Zero bytes appended to the output of xjpeg_destuff() so that the bit reader
+    can always load a whole word */
+#define XJPEG_DESTUFF_PAD (2*sizeof(xjpeg_decode_word))
+
+/* Copy the entropy coded segment that begins at pos to buf, removing the zero
+    bytes stuffed after 0xFF, the fill bytes and the RSTn markers.
+   The offset in buf just past each of the first nrst markers is stored in rst,
+    end is set to the first marker that is not a RSTn and len to the number of
+    bytes written, not counting XJPEG_DESTUFF_PAD zero bytes of padding.
+   Returns the number of RSTn markers found. */
+static int xjpeg_destuff(const unsigned char *pos, int size,
+ unsigned char *buf, int *rst, int nrst, const unsigned char **end, int *len) {
+  const unsigned char *p;
+  const unsigned char *q;
+  unsigned char *o;
+  int n;
+  n = 0;
+  p = pos;
+  q = pos + size;
+  o = buf;
+  *end = q;
+  while (p < q - 1) {
+    const unsigned char *ff;
+#if defined(__SSE2__)
+    /* Copy 16 bytes at a time up to the next 0xFF, which the output never
+        overtakes since it is at most as long as the input read */
+    while (q - p > 16) {
+      __m128i bytes;
+      int mask;
+      bytes = _mm_loadu_si128((const __m128i *)p);
+      _mm_storeu_si128((__m128i *)o, bytes);
+      mask = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes, _mm_set1_epi8(-1)));
+      if (mask) {
+        while (!(mask & 1)) {
+          mask >>= 1;
+          p++;
+          o++;
+        }
+        break;
+      }
+      p += 16;
+      o += 16;
+    }
+#endif
+    ff = (const unsigned char *)memchr(p, 0xFF, q - 1 - p);
+    if (ff == NULL) {
+      ff = q;
+    }
+    memcpy(o, p, ff - p);
+    o += ff - p;
+    p = ff;
+    if (p >= q - 1) {
+      break;
+    }
+    if (p[1] == 0x00) {
+      *o++ = 0xFF;
+      p += 2;
+      continue;
+    }
+    if (p[1] == 0xFF) {
+      p++;
+      continue;
+    }
+    if ((p[1] & 0xF8) != 0xD0) {
+      *end = p;
+      break;
+    }
+    if (n < nrst) {
+      rst[n] = o - buf;
+    }
+    n++;
+    p += 2;
+  }
+  if (*end == q && p < q) {
+    memcpy(o, p, q - p);
+    o += q - p;
+  }
+  *len = o - buf;
+  memset(o, 0, XJPEG_DESTUFF_PAD);
+  return n;
+}
+
+typedef struct xjpeg_scan_job xjpeg_scan_job;
+
+struct xjpeg_scan_job {
+  /* The start of the entropy coded data for this job, which begins bit bits
+      into the byte at pos */
+  const unsigned char *pos;
+  int bit;
+  /* The range of MCUs [start, end) decoded by this job */
+  int start;
+  int end;
+  /* The DC predictors at the start of the job */
+  short dc_pred[NCOMPS_MAX];
+  /* The offset of this job in the pack buffer and the values it wrote */
+  int index;
+  int size;
+  int packed[NCOMPS_MAX];
+  /* Was the job decoded by xjpeg_decode_pipelined() */
+  int pipelined;
+  const char *error;
+};
+
+typedef struct xjpeg_scan_jobs xjpeg_scan_jobs;
+
+struct xjpeg_scan_jobs {
+  xjpeg_decode_ctx *ctx;
+  /* A private copy of the decoder state for each worker thread */
+  xjpeg_decode_ctx *worker;
+  xjpeg_scan_job *job;
+  int njobs;
+  short *pack;
+  image_plane **plane;
+  xjpeg_decode_out out;
+  /* Are the jobs run in order on a single thread, so that each can pack its
+      values right after those of the previous job */
+  int chain;
+  /* The share of the threads each job has, which a job of yuv output uses to
+      overlap its entropy decoding with reconstruction */
+  int pipeline;
+  /* The MCU state every job starts from, besides its DC predictors */
+  xjpeg_mcu mcu;
+};
+
+/* Move the bit reader to bit bit of the byte at pos.
+   This relies on pos + size always pointing at the end of the buffer. */
+static void xjpeg_seek(xjpeg_decode_ctx *ctx, const unsigned char *pos,
+ int bit) {
+  ctx->size += ctx->pos - pos;
+  ctx->pos = pos;
+  ctx->bitbuf = 0;
+  ctx->bits = 0;
+  ctx->marker = 0;
+  ctx->error = NULL;
+  if (bit) {
+    XJPEG_FILL_BITS(ctx);
+    XJPEG_SKIP_BITS(ctx, bit);
+  }
+}
+
+/* Return the offset in bits from base of the next unread bit.
+   The bytes still buffered in bitbuf are walked back over, skipping any
+    stuffed zero bytes. */
+static long xjpeg_tell(const xjpeg_decode_ctx *ctx, const unsigned char *base) {
+  const unsigned char *p;
+  int n;
+  p = ctx->pos;
+  for (n = (ctx->bits + 7) >> 3; n > 0; n--) {
+    p--;
+    if (p[0] == 0x00 && p > base && p[-1] == 0xFF) {
+      p--;
+    }
+  }
+  return ((long)(p - base) << 3) + (-ctx->bits & 0x7);
+}
+
+static void xjpeg_decode_job(void *ctx, int thread, int task) {
+  xjpeg_scan_jobs *jobs;
+  xjpeg_scan_job *job;
+  xjpeg_decode_ctx *worker;
+  xjpeg_mcu mcu;
+  int end;
+  jobs = (xjpeg_scan_jobs *)ctx;
+  job = &jobs->job[task];
+  worker = &jobs->worker[thread];
+  if (jobs->chain && task > 0) {
+    job->index = job[-1].index + job[-1].size;
+  }
+  memcpy(&mcu, &jobs->mcu, sizeof(xjpeg_mcu));
+  mcu.index = job->index;
+  job->pipelined = 0;
+  /* Intervals with no MCUs in the crop region are not decoded at all, the
+      others only up to the end of the region */
+  end = GLJ_MINI(job->end, xjpeg_crop_end(&worker->scan));
+  if (xjpeg_crop_count(&worker->scan, job->start) <
+   xjpeg_crop_count(&worker->scan, end)) {
+    xjpeg_seek(worker, job->pos, job->bit);
+    memcpy(mcu.dc_pred, job->dc_pred, sizeof(mcu.dc_pred));
+    /* An image scaled down by 8 is not worth reconstructing separately */
+    job->pipelined = jobs->out == XJPEG_DECODE_YUV && worker->scale != 3 &&
+     jobs->pipeline >= 2 && xjpeg_decode_pipelined(worker, &mcu, jobs->plane,
+     job->start, end, jobs->pipeline) == EXIT_SUCCESS;
+    if (!job->pipelined) {
+      xjpeg_decode_mcus(worker, &mcu, jobs->pack, jobs->plane, jobs->out,
+       job->start, end);
+    }
+  }
+  job->size = mcu.index - job->index;
+  memcpy(job->packed, mcu.packed, sizeof(job->packed));
+  job->error = worker->error;
+}
+
+/* Add shift to the pack buffer offset of every block in the MCUs
+    [start, end) of the scan that are inside the crop region. */
+static void xjpeg_shift_index(xjpeg_decode_ctx *ctx,
+ image_plane *plane[NPLANES_MAX], int start, int end, int shift) {
+  const xjpeg_region *crop;
+  int m;
+  crop = &ctx->scan.crop;
+  for (m = start; m < end; m++) {
+    int mbx;
+    int mby;
+    int i;
+    mby = m/ctx->scan.nhmb;
+    mbx = m - mby*ctx->scan.nhmb;
+    if (mby < crop->y0 || mby >= crop->y1 || mbx < crop->x0 ||
+     mbx >= crop->x1) {
+      continue;
+    }
+    mby -= crop->y0;
+    mbx -= crop->x0;
+    for (i = 0; i < ctx->scan.ncomps; i++) {
+      xjpeg_scan_comp *comp;
+      image_plane *ip;
+      int sby;
+      int sbx;
+      comp = &ctx->scan.comp[i];
+      ip = plane[i];
+      for (sby = 0; sby < comp->vsamp; sby++) {
+        for (sbx = 0; sbx < comp->hsamp; sbx++) {
+          ip->index[(mby*comp->vsamp + sby)*(ip->ystride >> 3) +
+           mbx*comp->hsamp + sbx] += shift;
+        }
+      }
+    }
+  }
+}
+
+/* Each job decodes into the pack buffer at the largest offset it could
+    possibly need (64 values per block), so move the packed values down so
+    they are contiguous and fix up the block indeces to match. */
+static void xjpeg_pack_jobs(xjpeg_decode_ctx *ctx, xjpeg_scan_jobs *jobs) {
+  int index;
+  int k;
+  index = 0;
+  for (k = 0; k < jobs->njobs; k++) {
+    xjpeg_scan_job *job;
+    int shift;
+    job = &jobs->job[k];
+    shift = job->index - index;
+    if (shift != 0) {
+      memmove(jobs->pack + index, jobs->pack + job->index,
+       job->size*sizeof(short));
+      xjpeg_shift_index(ctx, jobs->plane, job->start, job->end, -shift);
+    }
+    index += job->size;
+  }
+}
+
+/* Decode all of the jobs, then collect their results and leave the bit
+    reader at end, the marker following the scan. */
+static void xjpeg_run_jobs(xjpeg_decode_ctx *ctx, xjpeg_scan_jobs *jobs,
+ int nthreads, const unsigned char *end) {
+  int i;
+  int k;
+  xjpeg_mcu_init(ctx, &jobs->mcu);
+  xjpeg_mcu_blocks(ctx, &jobs->mcu, jobs->plane);
+  glj_run_tasks(xjpeg_decode_job, jobs, jobs->njobs, nthreads);
+  for (k = 0; k < jobs->njobs; k++) {
+    if (jobs->job[k].error != NULL) {
+      ctx->error = jobs->job[k].error;
+    }
+    for (i = 0; i < ctx->scan.ncomps; i++) {
+      jobs->plane[i]->packed += jobs->job[k].packed[i];
+    }
+    ctx->npipelined += jobs->job[k].pipelined;
+  }
+  if (jobs->out == XJPEG_DECODE_PACK) {
+    xjpeg_pack_jobs(ctx, jobs);
+  }
+  ctx->size -= end - ctx->pos;
+  ctx->pos = end;
+  ctx->bitbuf = 0;
+  ctx->bits = 0;
+  ctx->marker = 0;
+}
+
+/* Decode every restart interval as an independent job on a pool of
+    ctx->nthreads workers, or the whole scan as a single job when there are no
+    restart intervals.
+   The scan is first copied without stuffed bytes or markers by
+    xjpeg_destuff(), so the workers read it without checking for 0xFF, and
+    since the DC predictors are reset at every RSTn marker the intervals can be
+    decoded in any order.
+   Returns EXIT_FAILURE without decoding anything if the markers found do not
+    match the restart interval, in which case the caller decodes serially. */
+static int xjpeg_decode_restarts(xjpeg_decode_ctx *ctx, short *pack,
+ image_plane *plane[NPLANES_MAX], xjpeg_decode_out out) {
+  xjpeg_scan_jobs jobs;
+  unsigned char *buf;
+  int *rst;
+  const unsigned char *end;
+  int len;
+  int nmcus;
+  int nblocks;
+  int nthreads;
+  int i;
+  int k;
+  nmcus = ctx->scan.nhmb*ctx->scan.nvmb;
+  jobs.njobs = 1;
+  if (ctx->restart_interval) {
+    jobs.njobs = (nmcus + ctx->restart_interval - 1)/ctx->restart_interval;
+  }
+  /* Only the scan is copied, not the rest of the file after it, e.g., the
+      other scans of a non-interleaved frame */
+  if (xjpeg_find_rst(ctx->pos, ctx->size, NULL, 0, &end) < jobs.njobs - 1) {
+    return EXIT_FAILURE;
+  }
+  buf = (unsigned char *)malloc((end - ctx->pos) + XJPEG_DESTUFF_PAD);
+  rst = (int *)malloc(jobs.njobs*sizeof(*rst));
+  if (buf == NULL || rst == NULL) {
+    free(rst);
+    free(buf);
+    return EXIT_FAILURE;
+  }
+  rst[0] = 0;
+  xjpeg_destuff(ctx->pos, end - ctx->pos, buf, rst + 1, jobs.njobs - 1, &end,
+   &len);
+  nthreads = GLJ_MINI(ctx->nthreads, jobs.njobs);
+  jobs.job = (xjpeg_scan_job *)malloc(jobs.njobs*sizeof(xjpeg_scan_job));
+  jobs.worker =
+   (xjpeg_decode_ctx *)malloc(nthreads*sizeof(xjpeg_decode_ctx));
+  if (jobs.job == NULL || jobs.worker == NULL) {
+    free(jobs.worker);
+    free(jobs.job);
+    free(rst);
+    free(buf);
+    return EXIT_FAILURE;
+  }
+  nblocks = 0;
+  for (i = 0; i < ctx->scan.ncomps; i++) {
+    nblocks += ctx->scan.comp[i].hsamp*ctx->scan.comp[i].vsamp;
+  }
+  for (k = 0; k < jobs.njobs; k++) {
+    xjpeg_scan_job *job;
+    job = &jobs.job[k];
+    job->pos = buf + rst[k];
+    job->bit = 0;
+    job->start = k*ctx->restart_interval;
+    job->end = nmcus;
+    if (ctx->restart_interval) {
+      job->end = GLJ_MINI(job->start + ctx->restart_interval, nmcus);
+    }
+    memset(job->dc_pred, 0, sizeof(job->dc_pred));
+    job->index = xjpeg_crop_count(&ctx->scan, job->start)*nblocks*64;
+    job->error = NULL;
+  }
+  for (k = 0; k < nthreads; k++) {
+    xjpeg_decode_ctx *worker;
+    worker = &jobs.worker[k];
+    memcpy(worker, ctx, sizeof(xjpeg_decode_ctx));
+    worker->pos = buf;
+    worker->size = len + XJPEG_DESTUFF_PAD;
+    worker->unstuffed = 1;
+  }
+  jobs.ctx = ctx;
+  jobs.pack = pack;
+  jobs.plane = plane;
+  jobs.out = out;
+  jobs.chain = nthreads == 1;
+  jobs.pipeline = ctx->nthreads/jobs.njobs;
+  xjpeg_run_jobs(ctx, &jobs, nthreads, end);
+  free(jobs.worker);
+  free(jobs.job);
+  free(rst);
+  free(buf);
+  return EXIT_SUCCESS;
+}
+
+/* Chunks smaller than this are not worth decoding speculatively. */
+#define XJPEG_CHUNK_MIN (4096)
+
+typedef struct xjpeg_sync xjpeg_sync;
+
+struct xjpeg_sync {
+  /* The offset in bits from the start of the scan of an MCU boundary */
+  long pos;
+  /* The MCU index, only known for certain once a chunk is synchronized */
+  int mcu;
+  short dc_pred[NCOMPS_MAX];
+};
+
+typedef struct xjpeg_chunk xjpeg_chunk;
+
+struct xjpeg_chunk {
+  /* The first byte of the chunk, decoding starts at bit 0 of this byte */
+  const unsigned char *pos;
+  /* The offset in bits of the end of the chunk */
+  long limit;
+  /* Every MCU boundary found decoding from pos, up to the first one at or
+      past limit, which is stored in exit */
+  xjpeg_sync *sync;
+  int nsync;
+  int nsync_max;
+  xjpeg_sync exit;
+  int exited;
+};
+
+typedef struct xjpeg_spec xjpeg_spec;
+
+struct xjpeg_spec {
+  xjpeg_decode_ctx *ctx;
+  xjpeg_decode_ctx *worker;
+  xjpeg_chunk *chunk;
+  const unsigned char *base;
+};
+
+/* Decode the symbols of a chunk starting at an arbitrary byte, assuming it
+    is the start of an MCU, and record every MCU boundary along the way.
+   Huffman codes are self-synchronizing, so once the true decode reaches any
+    one of these boundaries the rest of the chunk is known to be correct. */
+static void xjpeg_sync_chunk(void *ctx, int thread, int task) {
+  xjpeg_spec *spec;
+  xjpeg_chunk *chunk;
+  xjpeg_decode_ctx *worker;
+  xjpeg_mcu mcu;
+  spec = (xjpeg_spec *)ctx;
+  chunk = &spec->chunk[task];
+  worker = &spec->worker[thread];
+  xjpeg_seek(worker, chunk->pos, 0);
+  xjpeg_mcu_init(spec->ctx, &mcu);
+  chunk->nsync = 0;
+  chunk->exited = 0;
+  while (!worker->error) {
+    xjpeg_sync *sync;
+    long pos;
+    pos = xjpeg_tell(worker, spec->base);
+    if (pos >= chunk->limit) {
+      chunk->exit.pos = pos;
+      chunk->exit.mcu = chunk->nsync;
+      memcpy(chunk->exit.dc_pred, mcu.dc_pred, sizeof(mcu.dc_pred));
+      chunk->exited = 1;
+      break;
+    }
+    if (chunk->nsync == chunk->nsync_max) {
+      break;
+    }
+    sync = &chunk->sync[chunk->nsync];
+    sync->pos = pos;
+    sync->mcu = chunk->nsync;
+    memcpy(sync->dc_pred, mcu.dc_pred, sizeof(mcu.dc_pred));
+    chunk->nsync++;
+    xjpeg_skip_mcu(worker, &mcu);
+    /* Past the marker that ends the scan the bit reader only returns zero
+        padding and never moves, so the limit would not be reached.
+       The offset of the next MCU is not known exactly there, so the chunk is
+        left without an exit and stepped through when carrying the state. */
+    if (worker->marker) {
+      break;
+    }
+  }
+}
+
+/* Decode a scan without restart markers in parallel by splitting the
+    entropy coded segment into one chunk per thread.
+   Each chunk is first decoded speculatively (symbols only) from its first
+    byte.
+   Then, walking the chunks in order, the true decoder state at the start of
+    each chunk is carried forward until it lands on an MCU boundary that the
+    speculative decode of that chunk also found, at which point the chunk's
+    own end state can be used, adjusted by the now known MCU index and DC
+    predictors.
+   This is usually within a few MCUs, and if a chunk never synchronizes it is
+    simply stepped through serially.
+   Finally every chunk is decoded again in parallel, starting from its exact
+    state, to produce the output. */
+static int xjpeg_decode_speculative(xjpeg_decode_ctx *ctx, short *pack,
+ image_plane *plane[NPLANES_MAX], xjpeg_decode_out out) {
+  xjpeg_scan_jobs jobs;
+  xjpeg_spec spec;
+  xjpeg_sync *sync;
+  xjpeg_sync state;
+  xjpeg_decode_ctx *worker;
+  xjpeg_mcu mcu;
+  const unsigned char *end;
+  long size;
+  int nchunks;
+  int nsync_max;
+  int nmcus;
+  int nblocks;
+  int i;
+  int k;
+  if (xjpeg_find_rst(ctx->pos, ctx->size, NULL, 0, &end) != 0) {
+    return EXIT_FAILURE;
+  }
+  size = end - ctx->pos;
+  nchunks = GLJ_MINI(ctx->nthreads, (int)(size/XJPEG_CHUNK_MIN));
+  if (nchunks < 2) {
+    return EXIT_FAILURE;
+  }
+  nmcus = ctx->scan.nhmb*ctx->scan.nvmb;
+  nblocks = 0;
+  for (i = 0; i < ctx->scan.ncomps; i++) {
+    nblocks += ctx->scan.comp[i].hsamp*ctx->scan.comp[i].vsamp;
+  }
+  /* Every block takes at least 2 bits (a DC symbol and an EOB) which bounds
+      the number of MCU boundaries in the bits of a chunk. */
+  nsync_max = GLJ_MINI(nmcus + 1,
+   (int)(((size + nchunks - 1)/nchunks << 3)/(2*nblocks) + 2));
+  spec.chunk = (xjpeg_chunk *)malloc(nchunks*sizeof(xjpeg_chunk));
+  spec.worker = (xjpeg_decode_ctx *)malloc(nchunks*sizeof(xjpeg_decode_ctx));
+  sync = (xjpeg_sync *)malloc((size_t)nchunks*nsync_max*sizeof(xjpeg_sync));
+  jobs.job = (xjpeg_scan_job *)malloc(nchunks*sizeof(xjpeg_scan_job));
+  if (spec.chunk == NULL || spec.worker == NULL || sync == NULL ||
+   jobs.job == NULL) {
+    free(jobs.job);
+    free(sync);
+    free(spec.worker);
+    free(spec.chunk);
+    return EXIT_FAILURE;
+  }
+  spec.ctx = ctx;
+  spec.base = ctx->pos;
+  for (k = 0; k < nchunks; k++) {
+    xjpeg_chunk *chunk;
+    chunk = &spec.chunk[k];
+    chunk->pos = spec.base + k*size/nchunks;
+    /* Never start on the zero byte stuffed after 0xFF. */
+    if (k > 0 && chunk->pos[0] == 0x00 && chunk->pos[-1] == 0xFF) {
+      chunk->pos++;
+    }
+    chunk->limit = ((k + 1)*size/nchunks) << 3;
+    chunk->sync = sync + (size_t)k*nsync_max;
+    chunk->nsync_max = GLJ_MINI(nsync_max,
+     (int)((chunk->limit - ((chunk->pos - spec.base) << 3))/(2*nblocks) + 2));
+    chunk->nsync = 0;
+    chunk->exited = 0;
+    memcpy(&spec.worker[k], ctx, sizeof(xjpeg_decode_ctx));
+  }
+  /* The last chunk always runs to the end of the scan from the state carried
+      into it, so its MCU boundaries are never looked at */
+  glj_run_tasks(xjpeg_sync_chunk, &spec, nchunks - 1, nchunks - 1);
+  /* Carry the true decoder state across the chunk boundaries. */
+  worker = &spec.worker[0];
+  xjpeg_mcu_init(ctx, &mcu);
+  memset(&state, 0, sizeof(state));
+  jobs.njobs = 0;
+  for (k = 0; k < nchunks && state.mcu < nmcus; k++) {
+    xjpeg_chunk *chunk;
+    xjpeg_scan_job *job;
+    int seeked;
+    int n;
+    chunk = &spec.chunk[k];
+    job = &jobs.job[jobs.njobs++];
+    job->pos = spec.base + (state.pos >> 3);
+    job->bit = state.pos & 0x7;
+    job->start = state.mcu;
+    memcpy(job->dc_pred, state.dc_pred, sizeof(job->dc_pred));
+    job->index = xjpeg_crop_count(&ctx->scan, job->start)*nblocks*64;
+    job->error = NULL;
+    if (k == nchunks - 1) {
+      state.mcu = nmcus;
+    }
+    seeked = 0;
+    n = 0;
+    while (state.mcu < nmcus && state.pos < chunk->limit) {
+      while (n < chunk->nsync && chunk->sync[n].pos < state.pos) {
+        n++;
+      }
+      if (chunk->exited && n < chunk->nsync && chunk->sync[n].pos == state.pos) {
+        state.mcu += chunk->exit.mcu - chunk->sync[n].mcu;
+        for (i = 0; i < NCOMPS_MAX; i++) {
+          state.dc_pred[i] += chunk->exit.dc_pred[i] - chunk->sync[n].dc_pred[i];
+        }
+        state.pos = chunk->exit.pos;
+        break;
+      }
+      if (!seeked) {
+        xjpeg_seek(worker, spec.base + (state.pos >> 3), state.pos & 0x7);
+        memcpy(mcu.dc_pred, state.dc_pred, sizeof(mcu.dc_pred));
+        seeked = 1;
+      }
+      xjpeg_skip_mcu(worker, &mcu);
+      if (worker->error) {
+        break;
+      }
+      state.mcu++;
+      state.pos = xjpeg_tell(worker, spec.base);
+      memcpy(state.dc_pred, mcu.dc_pred, sizeof(mcu.dc_pred));
+    }
+    if (worker->error) {
+      break;
+    }
+    job->end = state.mcu = GLJ_MINI(state.mcu, nmcus);
+  }
+  if (worker->error || state.mcu < nmcus) {
+    free(jobs.job);
+    free(sync);
+    free(spec.worker);
+    free(spec.chunk);
+    return EXIT_FAILURE;
+  }
+  jobs.ctx = ctx;
+  jobs.worker = spec.worker;
+  jobs.pack = pack;
+  jobs.plane = plane;
+  jobs.out = out;
+  jobs.chain = 0;
+  jobs.pipeline = ctx->nthreads/jobs.njobs;
+  xjpeg_run_jobs(ctx, &jobs, nchunks, end);
+  free(jobs.job);
+  free(sync);
+  free(spec.worker);
+  free(spec.chunk);
+  return EXIT_SUCCESS;
+}
+
+/* Decode a scan from the entries of ctx->index, each a job that starts from
+    the exact decoder state stored in the entry.
+   Returns EXIT_FAILURE without decoding anything if the index does not match
+    the scan, in which case the caller decodes it as if there were none. */
+static int xjpeg_decode_indexed(xjpeg_decode_ctx *ctx, short *pack,
+ image_plane *plane[NPLANES_MAX], xjpeg_decode_out out) {
+  const xjpeg_index *index;
+  xjpeg_scan_jobs jobs;
+  const unsigned char *end;
+  int nmcus;
+  int nblocks;
+  int nthreads;
+  int i;
+  int k;
+  index = ctx->index;
+  nmcus = ctx->scan.nhmb*ctx->scan.nvmb;
+  /* The buffer always ends with the file, so the bytes left from the start
+      of the scan locate it in the file the index was built from */
+  if (ctx->stream != NULL || index->nentries == 0 ||
+   index->size - index->scan != ctx->size || index->nmcus != nmcus ||
+   ctx->scan.ncomps != ctx->frame.ncomps ||
+   (ctx->restart_interval && index->interval != ctx->restart_interval)) {
+    return EXIT_FAILURE;
+  }
+  end = ctx->pos + (index->end - index->scan);
+  if (end >= ctx->pos + ctx->size || end[0] != 0xFF) {
+    return EXIT_FAILURE;
+  }
+  jobs.njobs = index->nentries;
+  nthreads = GLJ_MINI(ctx->nthreads, jobs.njobs);
+  jobs.job = (xjpeg_scan_job *)malloc(jobs.njobs*sizeof(xjpeg_scan_job));
+  jobs.worker =
+   (xjpeg_decode_ctx *)malloc(nthreads*sizeof(xjpeg_decode_ctx));
+  if (jobs.job == NULL || jobs.worker == NULL) {
+    free(jobs.worker);
+    free(jobs.job);
+    return EXIT_FAILURE;
+  }
+  nblocks = 0;
+  for (i = 0; i < ctx->scan.ncomps; i++) {
+    nblocks += ctx->scan.comp[i].hsamp*ctx->scan.comp[i].vsamp;
+  }
+  for (k = 0; k < jobs.njobs; k++) {
+    xjpeg_scan_job *job;
+    const xjpeg_index_entry *entry;
+    job = &jobs.job[k];
+    entry = &index->entry[k];
+    job->pos = ctx->pos + (entry->pos >> 3);
+    job->bit = entry->pos & 0x7;
+    job->start = k*index->interval;
+    job->end = GLJ_MINI(job->start + index->interval, nmcus);
+    memcpy(job->dc_pred, entry->dc_pred, sizeof(job->dc_pred));
+    job->index = xjpeg_crop_count(&ctx->scan, job->start)*nblocks*64;
+    job->error = NULL;
+  }
+  for (k = 0; k < nthreads; k++) {
+    memcpy(&jobs.worker[k], ctx, sizeof(xjpeg_decode_ctx));
+  }
+  jobs.ctx = ctx;
+  jobs.pack = pack;
+  jobs.plane = plane;
+  jobs.out = out;
+  jobs.chain = nthreads == 1;
+  jobs.pipeline = ctx->nthreads/jobs.njobs;
+  xjpeg_run_jobs(ctx, &jobs, nthreads, end);
+  free(jobs.worker);
+  free(jobs.job);
+  return EXIT_SUCCESS;
+}
+
+static void xjpeg_decode_scan(xjpeg_decode_ctx *ctx, short *pack,
+ image_plane *plane[NPLANES_MAX], xjpeg_decode_out out) {
+  xjpeg_mcu mcu;
+  int nmcus;
+  int start;
+  int end;
+  int rst_counter;
+  int i;
+  nmcus = ctx->scan.nhmb*ctx->scan.nvmb;
+  if (ctx->index != NULL &&
+   xjpeg_decode_indexed(ctx, pack, plane, out) == EXIT_SUCCESS) {
+    return;
+  }
+  if (ctx->nthreads > 1 && !ctx->restart_interval &&
+   xjpeg_decode_speculative(ctx, pack, plane, out) == EXIT_SUCCESS) {
+    return;
+  }
+  if (xjpeg_decode_restarts(ctx, pack, plane, out) == EXIT_SUCCESS) {
+    return;
+  }
+  /* Fall back to reading the markers while decoding, e.g., if some are
+      missing */
+  xjpeg_mcu_init(ctx, &mcu);
+  xjpeg_mcu_blocks(ctx, &mcu, plane);
+  rst_counter = 0;
+  for (start = 0; start < nmcus; start = end) {
+    end = nmcus;
+    if (ctx->restart_interval) {
+      end = GLJ_MINI(start + ctx->restart_interval, nmcus);
+    }
+    end = GLJ_MINI(end, xjpeg_crop_end(&ctx->scan));
+    xjpeg_decode_mcus(ctx, &mcu, pack, plane, out, start, end);
+    XJPEG_LOG(("start = %i, end = %i, rst_counter = %i\n", start, end,
+     rst_counter));
+    if (ctx->error) {
+      break;
+    }
+    if (end == nmcus) {
+      xjpeg_end_scan(ctx);
+      break;
+    }
+    /* Skip the rest of the scan once the crop region is decoded */
+    if (end >= xjpeg_crop_end(&ctx->scan)) {
+      xjpeg_skip_scan(ctx);
+      break;
+    }
+    xjpeg_decode_rst(ctx, &mcu, rst_counter);
+    if (ctx->error || ctx->marker == 0xD9) {
+      break;
+    }
+    rst_counter++;
+  }
+  for (i = 0; i < ctx->scan.ncomps; i++) {
+    plane[i]->packed += mcu.packed[i];
+  }
+}
+
+struct xjpeg_deferred_scan {
+  /* A copy of the decoder state at the start of the entropy coded data of the
+      scan, including the tables and restart interval it uses */
+  xjpeg_decode_ctx ctx;
+  image_plane *plane[NPLANES_MAX];
+  xjpeg_decode_out out;
+  /* Where the scan writes its packed values, past the largest number the
+      scans before it could need, and the number it wrote */
+  short *pack;
+  int size;
+};
+
+static void xjpeg_decode_deferred_scan(void *ctx, int thread, int task) {
+  xjpeg_deferred_scan *ds;
+  int i;
+  (void)thread;
+  ds = &((xjpeg_decode_ctx *)ctx)->deferred[task];
+  ds->size = 0;
+  for (i = 0; i < ds->ctx.scan.ncomps; i++) {
+    ds->size -= ds->plane[i]->packed;
+  }
+  xjpeg_decode_scan(&ds->ctx, ds->pack, ds->plane, ds->out);
+  for (i = 0; i < ds->ctx.scan.ncomps; i++) {
+    ds->size += ds->plane[i]->packed;
+  }
+}
+
+/* Decode the deferred scans concurrently, each with a share of the worker
+    threads, then move their packed values down to follow one another. */
+static void xjpeg_decode_deferred_scans(xjpeg_decode_ctx *ctx, image *img) {
+  int index;
+  int k;
+  if (ctx->ndeferred == 0) {
+    return;
+  }
+  for (k = 0; k < ctx->ndeferred; k++) {
+    ctx->deferred[k].ctx.nthreads = GLJ_MAXI(1, ctx->nthreads/ctx->ndeferred);
+  }
+  glj_run_tasks(xjpeg_decode_deferred_scan, ctx, ctx->ndeferred,
+   ctx->nthreads);
+  index = ctx->deferred[0].pack - img->coef;
+  for (k = 0; k < ctx->ndeferred; k++) {
+    xjpeg_deferred_scan *ds;
+    ds = &ctx->deferred[k];
+    if (ds->ctx.error != NULL) {
+      ctx->error = ds->ctx.error;
+    }
+    if (ds->out == XJPEG_DECODE_PACK) {
+      memmove(img->coef + index, ds->pack, ds->size*sizeof(short));
+      xjpeg_shift_index(&ds->ctx, ds->plane, 0,
+       ds->ctx.scan.nhmb*ds->ctx.scan.nvmb, index);
+      index += ds->size;
+    }
+  }
+  ctx->ndeferred = 0;
+}
+
+/* Set aside a baseline scan that codes only some of the components of the
+    frame and skip over its entropy coded data.
+   The scans of such a frame each write to their own planes, so once the rest
+    of them have been found they can all be decoded concurrently. */
+static void xjpeg_defer_scan(xjpeg_decode_ctx *ctx, image *img,
+ image_plane *plane[NPLANES_MAX], xjpeg_decode_out out) {
+  xjpeg_deferred_scan *ds;
+  const unsigned char *end;
+  int i;
+  int j;
+  int k;
+  if (ctx->deferred == NULL) {
+    ctx->deferred = (xjpeg_deferred_scan *)malloc(
+     NCOMPS_MAX*sizeof(xjpeg_deferred_scan));
+    XJPEG_ERROR(ctx, ctx->deferred == NULL, "Error allocating scan buffer.");
+    if (ctx->deferred == NULL) {
+      return;
+    }
+  }
+  /* A component coded again must wait for the scans before it */
+  for (k = 0; k < ctx->ndeferred; k++) {
+    for (i = 0; i < ctx->deferred[k].ctx.scan.ncomps; i++) {
+      for (j = 0; j < ctx->scan.ncomps; j++) {
+        if (ctx->deferred[k].plane[i] == plane[j]) {
+          xjpeg_decode_deferred_scans(ctx, img);
+        }
+      }
+    }
+  }
+  ds = &ctx->deferred[ctx->ndeferred];
+  if (ctx->ndeferred == 0) {
+    ds->pack = img->coef;
+    for (i = 0; i < img->nplanes; i++) {
+      ds->pack += img->plane[i].packed;
+    }
+  }
+  else {
+    xjpeg_scan_header *scan;
+    int nblocks;
+    scan = &ds[-1].ctx.scan;
+    nblocks = 0;
+    for (i = 0; i < scan->ncomps; i++) {
+      nblocks += scan->comp[i].hsamp*scan->comp[i].vsamp;
+    }
+    ds->pack = ds[-1].pack +
+     xjpeg_crop_count(scan, scan->nhmb*scan->nvmb)*nblocks*64;
+  }
+  memcpy(&ds->ctx, ctx, sizeof(xjpeg_decode_ctx));
+  ds->ctx.deferred = NULL;
+  ds->ctx.ndeferred = 0;
+  memcpy(ds->plane, plane, sizeof(ds->plane));
+  ds->out = out;
+  ctx->ndeferred++;
+  xjpeg_find_rst(ctx->pos, ctx->size, NULL, 0, &end);
+  ctx->size -= end - ctx->pos;
+  ctx->pos = end;
+}
+
+/* Return the size in blocks of the image.coef buffer. */
+static int xjpeg_coef_blocks(image *img) {
+  int blocks;
+  int i;
+  blocks = 0;
+  for (i = 0; i < img->nplanes; i++) {
+    image_plane *ip;
+    ip = &img->plane[i];
+    blocks += ((ip->width >> (3 - img->scale)) << ip->xdec)*ip->cstride;
+  }
+  return blocks;
+}
+
+/* Return the MCUs of the frame decoded to the image, the crop region clipped
+    to the frame or the whole frame when there is none. */
+static void xjpeg_frame_crop(xjpeg_decode_ctx *ctx, xjpeg_region *crop) {
+  if (ctx->crop.x1 > ctx->crop.x0 && ctx->crop.y1 > ctx->crop.y0) {
+    crop->x0 = GLJ_MINI(ctx->crop.x0, ctx->frame.nhmb - 1);
+    crop->y0 = GLJ_MINI(ctx->crop.y0, ctx->frame.nvmb - 1);
+    crop->x1 = GLJ_MINI(ctx->crop.x1, ctx->frame.nhmb);
+    crop->y1 = GLJ_MINI(ctx->crop.y1, ctx->frame.nvmb);
+  }
+  else {
+    crop->x0 = 0;
+    crop->y0 = 0;
+    crop->x1 = ctx->frame.nhmb;
+    crop->y1 = ctx->frame.nvmb;
+  }
+}
+
+/* Set up the buffer the coefficients of a progressive or arithmetic coded
+    frame are accumulated in.
+   The output is only produced once every scan has been decoded, so this can
+    be image.coef itself unless the output is packed or the image only holds
+    a crop region. */
+static void xjpeg_coef_init(xjpeg_decode_ctx *ctx, image *img,
+ xjpeg_decode_out out) {
+  xjpeg_region crop;
+  int blocks;
+  int i;
+  xjpeg_frame_crop(ctx, &crop);
+  if (out != XJPEG_DECODE_PACK && crop.x0 == 0 && crop.y0 == 0 &&
+   crop.x1 == ctx->frame.nhmb && crop.y1 == ctx->frame.nvmb) {
+    ctx->coef = img->coef;
+    memset(ctx->coef, 0, xjpeg_coef_blocks(img)*64*sizeof(short));
+    for (i = 0; i < ctx->frame.ncomps; i++) {
+      ctx->coef_comp[i] = img->plane[i].coef;
+      ctx->coef_stride[i] = img->plane[i].width << (3 + img->scale);
+    }
+    return;
+  }
+  blocks = 0;
+  for (i = 0; i < ctx->frame.ncomps; i++) {
+    xjpeg_comp_info *pi;
+    pi = &ctx->frame.comp[i];
+    blocks += ctx->frame.nhmb*pi->hsamp*ctx->frame.nvmb*pi->vsamp;
+  }
+  ctx->coef = (short *)malloc(blocks*64*sizeof(short));
+  XJPEG_ERROR(ctx, ctx->coef == NULL, "Error allocating coefficient buffer.");
+  if (ctx->coef == NULL) {
+    return;
+  }
+  memset(ctx->coef, 0, blocks*64*sizeof(short));
+  blocks = 0;
+  for (i = 0; i < ctx->frame.ncomps; i++) {
+    xjpeg_comp_info *pi;
+    pi = &ctx->frame.comp[i];
+    ctx->coef_comp[i] = ctx->coef + blocks*64;
+    ctx->coef_stride[i] = ctx->frame.nhmb*pi->hsamp << 6;
+    blocks += ctx->frame.nhmb*pi->hsamp*ctx->frame.nvmb*pi->vsamp;
+  }
+}
+
+/* Compute the number of blocks per row and column of a component coded in a
+    non-interleaved scan, which covers only the component's own samples
+    rather than whole MCUs (A.2.2). */
+static void xjpeg_comp_blocks(xjpeg_decode_ctx *ctx, xjpeg_comp_info *pi,
+ int *bw, int *bh) {
+  int width;
+  int height;
+  width = (ctx->frame.width*pi->hsamp + ctx->frame.hmax - 1)/ctx->frame.hmax;
+  height = (ctx->frame.height*pi->vsamp + ctx->frame.vmax - 1)/ctx->frame.vmax;
+  *bw = (width + 7) >> 3;
+  *bh = (height + 7) >> 3;
+}
+
+static void xjpeg_decode_dc_first(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu,
+ int i, short *block) {
+  unsigned char symbol;
+  short value;
+  XJPEG_DECODE_VLC(ctx, mcu->dc_huff[i], symbol, value);
+  mcu->dc_pred[i] += value;
+  block[0] = mcu->dc_pred[i]*(1 << ctx->scan.al);
+}
+
+static void xjpeg_decode_dc_refine(xjpeg_decode_ctx *ctx, short *block) {
+  int bit;
+  XJPEG_FILL_BITS(ctx);
+  XJPEG_DECODE_BITS(ctx, 1, bit);
+  if (bit) {
+    block[0] |= 1 << ctx->scan.al;
+  }
+}
+
+static void xjpeg_decode_ac_first(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu,
+ short *block, int *eobrun) {
+  int k;
+  if (*eobrun > 0) {
+    (*eobrun)--;
+    return;
+  }
+  for (k = ctx->scan.ss; k <= ctx->scan.se; k++) {
+    unsigned char symbol;
+    int run;
+    int len;
+    int value;
+    XJPEG_DECODE_HUFF(ctx, mcu->ac_huff[0], symbol);
+    run = symbol >> 4;
+    len = symbol & 0xf;
+    if (len) {
+      k += run;
+      XJPEG_ERROR(ctx, k > 63, "Error indexing outside block.");
+      XJPEG_FILL_BITS(ctx);
+      XJPEG_DECODE_BITS(ctx, len, value);
+      value += XJPEG_HUFF_EXTEND(value, len);
+      block[DE_ZIG_ZAG[k & 63]] = value*(1 << ctx->scan.al);
+    }
+    else if (run == 15) {
+      k += 15;
+    }
+    else {
+      /* EOBn: this block and the next (1 << n) + bits - 1 blocks end here */
+      *eobrun = 1 << run;
+      if (run) {
+        XJPEG_FILL_BITS(ctx);
+        XJPEG_DECODE_BITS(ctx, run, value);
+        *eobrun += value;
+      }
+      (*eobrun)--;
+      break;
+    }
+  }
+}
+
+#define XJPEG_REFINE_COEF(ctx, coef, p1) \
+  do { \
+    int bit; \
+    XJPEG_FILL_BITS(ctx); \
+    XJPEG_DECODE_BITS(ctx, 1, bit); \
+    if (bit && ((coef) & (p1)) == 0) { \
+      (coef) += (coef) >= 0 ? (p1) : -(p1); \
+    } \
+  } \
+  while (0)
+
+/* Successive approximation refinement of the AC coefficients (G.1.2.3).
+   Every coefficient already non-zero receives a correction bit as it is
+    passed over, and newly significant coefficients have magnitude 1 << Al. */
+static void xjpeg_decode_ac_refine(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu,
+ short *block, int *eobrun) {
+  int p1;
+  int k;
+  p1 = 1 << ctx->scan.al;
+  k = ctx->scan.ss;
+  if (*eobrun == 0) {
+    for (; k <= ctx->scan.se; k++) {
+      unsigned char symbol;
+      int run;
+      int value;
+      XJPEG_DECODE_HUFF(ctx, mcu->ac_huff[0], symbol);
+      run = symbol >> 4;
+      value = 0;
+      if (symbol & 0xf) {
+        int bit;
+        XJPEG_ERROR(ctx, (symbol & 0xf) != 1, "Error invalid AC refinement.");
+        XJPEG_FILL_BITS(ctx);
+        XJPEG_DECODE_BITS(ctx, 1, bit);
+        value = bit ? p1 : -p1;
+      }
+      else if (run != 15) {
+        *eobrun = 1 << run;
+        if (run) {
+          XJPEG_FILL_BITS(ctx);
+          XJPEG_DECODE_BITS(ctx, run, value);
+          *eobrun += value;
+        }
+        break;
+      }
+      /* Skip run zero coefficients, refining those already non-zero */
+      for (; k <= ctx->scan.se; k++) {
+        short *coef;
+        coef = &block[DE_ZIG_ZAG[k]];
+        if (*coef != 0) {
+          XJPEG_REFINE_COEF(ctx, *coef, p1);
+        }
+        else if (--run < 0) {
+          break;
+        }
+      }
+      if (value) {
+        XJPEG_ERROR(ctx, k > ctx->scan.se, "Error indexing outside block.");
+        block[DE_ZIG_ZAG[k & 63]] = value;
+      }
+    }
+  }
+  if (*eobrun > 0) {
+    /* Within an EOB run only the non-zero coefficients are refined */
+    for (; k <= ctx->scan.se; k++) {
+      if (block[DE_ZIG_ZAG[k]] != 0) {
+        XJPEG_REFINE_COEF(ctx, block[DE_ZIG_ZAG[k]], p1);
+      }
+    }
+    (*eobrun)--;
+  }
+}
+
+/* The probability estimation state machine of the arithmetic decoder (Table
+    D.2).
+   Each entry is Qe shifted up by 16, or'ed with Next_Index_MPS shifted up by
+    8, Switch_MPS shifted up by 7 and Next_Index_LPS.
+   The last entry is not in the standard, it is a fixed probability of 0.5
+    used to decode the sign and correction bits. */
+#define XJPEG_QE(qe, lps, mps, sw) \
+ (((qe) << 16) | ((mps) << 8) | ((sw) << 7) | (lps))
+
+static const int XJPEG_QE_TBL[114] = {
+  XJPEG_QE(0x5a1d,   1,   1, 1), XJPEG_QE(0x2586,  14,   2, 0),
+  XJPEG_QE(0x1114,  16,   3, 0), XJPEG_QE(0x080b,  18,   4, 0),
+  XJPEG_QE(0x03d8,  20,   5, 0), XJPEG_QE(0x01da,  23,   6, 0),
+  XJPEG_QE(0x00e5,  25,   7, 0), XJPEG_QE(0x006f,  28,   8, 0),
+  XJPEG_QE(0x0036,  30,   9, 0), XJPEG_QE(0x001a,  33,  10, 0),
+  XJPEG_QE(0x000d,  35,  11, 0), XJPEG_QE(0x0006,   9,  12, 0),
+  XJPEG_QE(0x0003,  10,  13, 0), XJPEG_QE(0x0001,  12,  13, 0),
+  XJPEG_QE(0x5a7f,  15,  15, 1), XJPEG_QE(0x3f25,  36,  16, 0),
+  XJPEG_QE(0x2cf2,  38,  17, 0), XJPEG_QE(0x207c,  39,  18, 0),
+  XJPEG_QE(0x17b9,  40,  19, 0), XJPEG_QE(0x1182,  42,  20, 0),
+  XJPEG_QE(0x0cef,  43,  21, 0), XJPEG_QE(0x09a1,  45,  22, 0),
+  XJPEG_QE(0x072f,  46,  23, 0), XJPEG_QE(0x055c,  48,  24, 0),
+  XJPEG_QE(0x0406,  49,  25, 0), XJPEG_QE(0x0303,  51,  26, 0),
+  XJPEG_QE(0x0240,  52,  27, 0), XJPEG_QE(0x01b1,  54,  28, 0),
+  XJPEG_QE(0x0144,  56,  29, 0), XJPEG_QE(0x00f5,  57,  30, 0),
+  XJPEG_QE(0x00b7,  59,  31, 0), XJPEG_QE(0x008a,  60,  32, 0),
+  XJPEG_QE(0x0068,  62,  33, 0), XJPEG_QE(0x004e,  63,  34, 0),
+  XJPEG_QE(0x003b,  32,  35, 0), XJPEG_QE(0x002c,  33,   9, 0),
+  XJPEG_QE(0x5ae1,  37,  37, 1), XJPEG_QE(0x484c,  64,  38, 0),
+  XJPEG_QE(0x3a0d,  65,  39, 0), XJPEG_QE(0x2ef1,  67,  40, 0),
+  XJPEG_QE(0x261f,  68,  41, 0), XJPEG_QE(0x1f33,  69,  42, 0),
+  XJPEG_QE(0x19a8,  70,  43, 0), XJPEG_QE(0x1518,  72,  44, 0),
+  XJPEG_QE(0x1177,  73,  45, 0), XJPEG_QE(0x0e74,  74,  46, 0),
+  XJPEG_QE(0x0bfb,  75,  47, 0), XJPEG_QE(0x09f8,  77,  48, 0),
+  XJPEG_QE(0x0861,  78,  49, 0), XJPEG_QE(0x0706,  79,  50, 0),
+  XJPEG_QE(0x05cd,  48,  51, 0), XJPEG_QE(0x04de,  50,  52, 0),
+  XJPEG_QE(0x040f,  50,  53, 0), XJPEG_QE(0x0363,  51,  54, 0),
+  XJPEG_QE(0x02d4,  52,  55, 0), XJPEG_QE(0x025c,  53,  56, 0),
+  XJPEG_QE(0x01f8,  54,  57, 0), XJPEG_QE(0x01a4,  55,  58, 0),
+  XJPEG_QE(0x0160,  56,  59, 0), XJPEG_QE(0x0125,  57,  60, 0),
+  XJPEG_QE(0x00f6,  58,  61, 0), XJPEG_QE(0x00cb,  59,  62, 0),
+  XJPEG_QE(0x00ab,  61,  63, 0), XJPEG_QE(0x008f,  61,  32, 0),
+  XJPEG_QE(0x5b12,  65,  65, 1), XJPEG_QE(0x4d04,  80,  66, 0),
+  XJPEG_QE(0x412c,  81,  67, 0), XJPEG_QE(0x37d8,  82,  68, 0),
+  XJPEG_QE(0x2fe8,  83,  69, 0), XJPEG_QE(0x293c,  84,  70, 0),
+  XJPEG_QE(0x2379,  86,  71, 0), XJPEG_QE(0x1edf,  87,  72, 0),
+  XJPEG_QE(0x1aa9,  87,  73, 0), XJPEG_QE(0x174e,  72,  74, 0),
+  XJPEG_QE(0x1424,  72,  75, 0), XJPEG_QE(0x119c,  74,  76, 0),
+  XJPEG_QE(0x0f6b,  74,  77, 0), XJPEG_QE(0x0d51,  75,  78, 0),
+  XJPEG_QE(0x0bb6,  77,  79, 0), XJPEG_QE(0x0a40,  77,  48, 0),
+  XJPEG_QE(0x5832,  80,  81, 1), XJPEG_QE(0x4d1c,  88,  82, 0),
+  XJPEG_QE(0x438e,  89,  83, 0), XJPEG_QE(0x3bdd,  90,  84, 0),
+  XJPEG_QE(0x34ee,  91,  85, 0), XJPEG_QE(0x2eae,  92,  86, 0),
+  XJPEG_QE(0x299a,  93,  87, 0), XJPEG_QE(0x2516,  86,  71, 0),
+  XJPEG_QE(0x5570,  88,  89, 1), XJPEG_QE(0x4ca9,  95,  90, 0),
+  XJPEG_QE(0x44d9,  96,  91, 0), XJPEG_QE(0x3e22,  97,  92, 0),
+  XJPEG_QE(0x3824,  99,  93, 0), XJPEG_QE(0x32b4,  99,  94, 0),
+  XJPEG_QE(0x2e17,  93,  86, 0), XJPEG_QE(0x56a8,  95,  96, 1),
+  XJPEG_QE(0x4f46, 101,  97, 0), XJPEG_QE(0x47e5, 102,  98, 0),
+  XJPEG_QE(0x41cf, 103,  99, 0), XJPEG_QE(0x3c3d, 104, 100, 0),
+  XJPEG_QE(0x375e,  99,  93, 0), XJPEG_QE(0x5231, 105, 102, 0),
+  XJPEG_QE(0x4c0f, 106, 103, 0), XJPEG_QE(0x4639, 107, 104, 0),
+  XJPEG_QE(0x415e, 103,  99, 0), XJPEG_QE(0x5627, 105, 106, 1),
+  XJPEG_QE(0x50e7, 108, 107, 0), XJPEG_QE(0x4b85, 109, 103, 0),
+  XJPEG_QE(0x5597, 110, 109, 0), XJPEG_QE(0x504f, 111, 107, 0),
+  XJPEG_QE(0x5a10, 110, 111, 1), XJPEG_QE(0x5522, 112, 109, 0),
+  XJPEG_QE(0x59eb, 112, 111, 1), XJPEG_QE(0x5a1d, 113, 113, 0)
+};
+
+#define XJPEG_ARITH_FIXED (113)
+
+typedef struct xjpeg_arith xjpeg_arith;
+
+/* The state of the arithmetic decoder for the scan being decoded.
+   Each statistics bin holds the index of its state in XJPEG_QE_TBL, with the
+    sense of the more probable symbol in the high bit. */
+struct xjpeg_arith {
+  /* The code register C, the probability interval A, and the number of bits
+      of C left before another byte is read CT (D.2) */
+  int c;
+  int a;
+  int ct;
+  /* Statistics bins for each conditioning table (F.1.4.4) */
+  unsigned char dc_stats[NHUFF_MAX][64];
+  unsigned char ac_stats[NHUFF_MAX][256];
+  /* A bin that always has a probability of 0.5 */
+  unsigned char fixed;
+  /* The DC conditioning category of each scan component */
+  int dc_context[NCOMPS_MAX];
+};
+
+/* Reset the decoder at the start of a scan or restart interval, the first
+    decision reads two bytes into C. */
+static void xjpeg_arith_init(xjpeg_arith *ar) {
+  memset(ar, 0, sizeof(xjpeg_arith));
+  ar->ct = -16;
+  ar->fixed = XJPEG_ARITH_FIXED;
+}
+
+/* Read the next byte of entropy coded data for the arithmetic decoder.
+   Unlike the huffman decoder, it may read ahead into the marker that ends the
+    data, after which zero bytes are supplied (D.2.6) and pos is left at the
+    marker. */
+static int xjpeg_arith_byte(xjpeg_decode_ctx *ctx) {
+  const unsigned char *p;
+  const unsigned char *q;
+  if (ctx->marker || ctx->size < 1) {
+    return 0;
+  }
+  p = ctx->pos;
+  q = ctx->pos + ctx->size;
+  if (*p++ == 0xFF) {
+    while (p < q && *p == 0xFF) {
+      p++;
+    }
+    if (p < q && *p == 0x00) {
+      ctx->size -= p + 1 - ctx->pos;
+      ctx->pos = p + 1;
+      return 0xFF;
+    }
+    /* Leave pos at the 0xFF before the marker */
+    ctx->marker = p < q ? *p : 0xD9;
+    p--;
+  }
+  ctx->size -= p - ctx->pos;
+  ctx->pos = p;
+  return ctx->marker ? 0 : p[-1];
+}
+
+/* Advance to the marker that ends the entropy coded data, which the
+    arithmetic decoder may not have read as far as. */
+static void xjpeg_arith_end(xjpeg_decode_ctx *ctx) {
+  while (!ctx->marker && ctx->size > 0) {
+    xjpeg_arith_byte(ctx);
+  }
+}
+
+/* Decode a single binary decision using the statistics bin st, updating its
+    probability estimate (D.2.4, D.2.5). */
+static int xjpeg_arith_decode(xjpeg_decode_ctx *ctx, xjpeg_arith *ar,
+ unsigned char *st) {
+  int sv;
+  int qe;
+  int nl;
+  int nm;
+  int temp;
+  /* Renormalize, reading in another byte every 8 bits (D.2.6) */
+  while (ar->a < 0x8000) {
+    if (--ar->ct < 0) {
+      ar->c = (ar->c << 8) | xjpeg_arith_byte(ctx);
+      ar->ct += 8;
+      if (ar->ct < 0 && ++ar->ct == 0) {
+        /* The two initial bytes have been read */
+        ar->a = 0x8000;
+      }
+    }
+    ar->a <<= 1;
+  }
+  sv = *st;
+  qe = XJPEG_QE_TBL[sv & 0x7F];
+  nl = qe & 0xFF;
+  nm = (qe >> 8) & 0xFF;
+  qe >>= 16;
+  ar->a -= qe;
+  temp = ar->a << ar->ct;
+  if (ar->c >= temp) {
+    ar->c -= temp;
+    /* Conditional exchange of the less probable symbol */
+    if (ar->a < qe) {
+      *st = (sv & 0x80) ^ nm;
+    }
+    else {
+      *st = (sv & 0x80) ^ nl;
+      sv ^= 0x80;
+    }
+    ar->a = qe;
+  }
+  else if (ar->a < 0x8000) {
+    /* Conditional exchange of the more probable symbol */
+    if (ar->a < qe) {
+      *st = (sv & 0x80) ^ nl;
+      sv ^= 0x80;
+    }
+    else {
+      *st = (sv & 0x80) ^ nm;
+    }
+  }
+  return sv >> 7;
+}
+
+/* Decode the DC difference of a block (F.2.4.1), conditioned on the
+    difference of the previous block of the component (F.1.4.4.1). */
+static void xjpeg_arith_dc_first(xjpeg_decode_ctx *ctx, xjpeg_arith *ar,
+ xjpeg_mcu *mcu, int i, short *block) {
+  int tbl;
+  unsigned char *st;
+  tbl = ctx->scan.comp[i].td;
+  st = ar->dc_stats[tbl] + ar->dc_context[i];
+  if (xjpeg_arith_decode(ctx, ar, st) == 0) {
+    ar->dc_context[i] = 0;
+  }
+  else {
+    int sign;
+    int m;
+    int v;
+    sign = xjpeg_arith_decode(ctx, ar, st + 1);
+    st += 2 + sign;
+    /* Decode the magnitude category, then the bits below the leading one */
+    m = xjpeg_arith_decode(ctx, ar, st);
+    if (m) {
+      st = ar->dc_stats[tbl] + 20;
+      while (xjpeg_arith_decode(ctx, ar, st)) {
+        if ((m <<= 1) == 0x8000) {
+          XJPEG_ERROR(ctx, 1, "Error arithmetic coded DC magnitude overflow.");
+          return;
+        }
+        st++;
+      }
+    }
+    if (m < (1 << ctx->arith_dc_l[tbl]) >> 1) {
+      ar->dc_context[i] = 0;
+    }
+    else if (m > (1 << ctx->arith_dc_u[tbl]) >> 1) {
+      ar->dc_context[i] = 12 + sign*4;
+    }
+    else {
+      ar->dc_context[i] = 4 + sign*4;
+    }
+    v = m;
+    st += 14;
+    while (m >>= 1) {
+      if (xjpeg_arith_decode(ctx, ar, st)) {
+        v |= m;
+      }
+    }
+    v++;
+    mcu->dc_pred[i] += sign ? -v : v;
+  }
+  block[0] = mcu->dc_pred[i]*(1 << ctx->scan.al);
+}
+
+static void xjpeg_arith_dc_refine(xjpeg_decode_ctx *ctx, xjpeg_arith *ar,
+ short *block) {
+  if (xjpeg_arith_decode(ctx, ar, &ar->fixed)) {
+    block[0] |= 1 << ctx->scan.al;
+  }
+}
+
+/* Decode the AC coefficients of a block in [Ss, Se] (F.2.4.2).
+   A sequential scan is decoded as a first scan of coefficients 1 to 63. */
+static void xjpeg_arith_ac_first(xjpeg_decode_ctx *ctx, xjpeg_arith *ar,
+ int i, short *block) {
+  int tbl;
+  int k;
+  tbl = ctx->scan.comp[i].ta;
+  for (k = GLJ_MAXI(ctx->scan.ss, 1); k <= ctx->scan.se; k++) {
+    unsigned char *st;
+    int sign;
+    int m;
+    int v;
+    st = ar->ac_stats[tbl] + 3*(k - 1);
+    if (xjpeg_arith_decode(ctx, ar, st)) {
+      /* End of block */
+      break;
+    }
+    while (xjpeg_arith_decode(ctx, ar, st + 1) == 0) {
+      st += 3;
+      if (++k > ctx->scan.se) {
+        XJPEG_ERROR(ctx, 1, "Error indexing outside block.");
+        return;
+      }
+    }
+    sign = xjpeg_arith_decode(ctx, ar, &ar->fixed);
+    st += 2;
+    m = xjpeg_arith_decode(ctx, ar, st);
+    if (m && xjpeg_arith_decode(ctx, ar, st)) {
+      m <<= 1;
+      st = ar->ac_stats[tbl] + (k <= ctx->arith_ac_k[tbl] ? 189 : 217);
+      while (xjpeg_arith_decode(ctx, ar, st)) {
+        if ((m <<= 1) == 0x8000) {
+          XJPEG_ERROR(ctx, 1, "Error arithmetic coded AC magnitude overflow.");
+          return;
+        }
+        st++;
+      }
+    }
+    v = m;
+    st += 14;
+    while (m >>= 1) {
+      if (xjpeg_arith_decode(ctx, ar, st)) {
+        v |= m;
+      }
+    }
+    v++;
+    block[DE_ZIG_ZAG[k]] = (sign ? -v : v)*(1 << ctx->scan.al);
+  }
+}
+
+/* Successive approximation refinement of the AC coefficients (G.1.3.3).
+   End of block is only coded past the last coefficient that was already
+    non-zero. */
+static void xjpeg_arith_ac_refine(xjpeg_decode_ctx *ctx, xjpeg_arith *ar,
+ int i, short *block) {
+  int tbl;
+  int p1;
+  int kex;
+  int k;
+  tbl = ctx->scan.comp[i].ta;
+  p1 = 1 << ctx->scan.al;
+  for (kex = ctx->scan.se; kex > 0; kex--) {
+    if (block[DE_ZIG_ZAG[kex]] != 0) {
+      break;
+    }
+  }
+  for (k = ctx->scan.ss; k <= ctx->scan.se; k++) {
+    unsigned char *st;
+    st = ar->ac_stats[tbl] + 3*(k - 1);
+    if (k > kex && xjpeg_arith_decode(ctx, ar, st)) {
+      break;
+    }
+    for (;;) {
+      short *coef;
+      coef = &block[DE_ZIG_ZAG[k]];
+      if (*coef != 0) {
+        if (xjpeg_arith_decode(ctx, ar, st + 2)) {
+          *coef += *coef < 0 ? -p1 : p1;
+        }
+        break;
+      }
+      if (xjpeg_arith_decode(ctx, ar, st + 1)) {
+        *coef = xjpeg_arith_decode(ctx, ar, &ar->fixed) ? -p1 : p1;
+        break;
+      }
+      st += 3;
+      if (++k > ctx->scan.se) {
+        XJPEG_ERROR(ctx, 1, "Error indexing outside block.");
+        return;
+      }
+    }
+  }
+}
+
+static void xjpeg_decode_arith_block(xjpeg_decode_ctx *ctx, xjpeg_arith *ar,
+ xjpeg_mcu *mcu, int i, short *block) {
+  if (ctx->scan.ss == 0) {
+    if (ctx->scan.ah == 0) {
+      xjpeg_arith_dc_first(ctx, ar, mcu, i, block);
+    }
+    else {
+      xjpeg_arith_dc_refine(ctx, ar, block);
+    }
+  }
+  if (ctx->scan.se != 0) {
+    if (ctx->scan.ah == 0) {
+      xjpeg_arith_ac_first(ctx, ar, i, block);
+    }
+    else {
+      xjpeg_arith_ac_refine(ctx, ar, i, block);
+    }
+  }
+}
+
+static void xjpeg_decode_prog_block(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu,
+ xjpeg_arith *ar, int i, short *block, int *eobrun) {
+  if (ctx->frame.arithmetic) {
+    xjpeg_decode_arith_block(ctx, ar, mcu, i, block);
+    return;
+  }
+  if (ctx->scan.ss == 0) {
+    if (ctx->scan.ah == 0) {
+      xjpeg_decode_dc_first(ctx, mcu, i, block);
+    }
+    else {
+      xjpeg_decode_dc_refine(ctx, block);
+    }
+  }
+  else {
+    if (ctx->scan.ah == 0) {
+      xjpeg_decode_ac_first(ctx, mcu, block, eobrun);
+    }
+    else {
+      xjpeg_decode_ac_refine(ctx, mcu, block, eobrun);
+    }
+  }
+}
+
+/* Decode one scan of a progressive or arithmetic coded frame, accumulating
+    the quantized coefficients in ctx->coef.
+   Interleaved scans are coded in MCU order, a scan with a single component
+    is coded block by block in raster order. */
+static void xjpeg_decode_prog_scan(xjpeg_decode_ctx *ctx) {
+  xjpeg_mcu mcu;
+  xjpeg_arith ar;
+  short *coef[NCOMPS_MAX];
+  int stride[NCOMPS_MAX];
+  int bw;
+  int bh;
+  int nunits;
+  int eobrun;
+  int rst_counter;
+  int n;
+  int i;
+  xjpeg_mcu_init(ctx, &mcu);
+  xjpeg_arith_init(&ar);
+  for (i = 0; i < ctx->scan.ncomps; i++) {
+    coef[i] = ctx->coef_comp[ctx->scan.comp[i].ci];
+    stride[i] = ctx->coef_stride[ctx->scan.comp[i].ci];
+  }
+  bw = ctx->scan.nhmb;
+  bh = ctx->scan.nvmb;
+  nunits = bw*bh;
+  eobrun = 0;
+  rst_counter = 0;
+  for (n = 0; n < nunits; n++) {
+    int mby;
+    int mbx;
+    mby = n/bw;
+    mbx = n - mby*bw;
+    if (ctx->scan.ncomps > 1) {
+      for (i = 0; i < ctx->scan.ncomps; i++) {
+        xjpeg_comp_info *pi;
+        int sby;
+        int sbx;
+        pi = &ctx->frame.comp[ctx->scan.comp[i].ci];
+        for (sby = 0; sby < pi->vsamp; sby++) {
+          for (sbx = 0; sbx < pi->hsamp; sbx++) {
+            xjpeg_decode_prog_block(ctx, &mcu, &ar, i,
+             coef[i] + (mby*pi->vsamp + sby)*stride[i] +
+             ((mbx*pi->hsamp + sbx) << 6), &eobrun);
+          }
+        }
+      }
+    }
+    else {
+      xjpeg_decode_prog_block(ctx, &mcu, &ar, 0,
+       coef[0] + mby*stride[0] + (mbx << 6), &eobrun);
+    }
+    if (ctx->error) {
+      return;
+    }
+    if (n + 1 == nunits) {
+      if (ctx->frame.arithmetic) {
+        xjpeg_arith_end(ctx);
+      }
+      xjpeg_end_scan(ctx);
+    }
+    else if (ctx->restart_interval && (n + 1)%ctx->restart_interval == 0) {
+      if (ctx->frame.arithmetic) {
+        xjpeg_arith_end(ctx);
+        xjpeg_arith_init(&ar);
+      }
+      xjpeg_decode_rst(ctx, &mcu, rst_counter);
+      if (ctx->error || ctx->marker == 0xD9) {
+        return;
+      }
+      eobrun = 0;
+      rst_counter++;
+    }
+  }
+}
+
+/* Emit the packed representation of a block of quantized coefficients, the
+    same run / value pairs xjpeg_decode_mcus() writes for a baseline scan. */
+static int xjpeg_pack_block(const short *block, short *pack) {
+  int n;
+  int last;
+  int k;
+  n = 0;
+  pack[n++] = block[0] & 0xfff;
+  last = 0;
+  for (k = 1; k < 64; k++) {
+    int run;
+    if (block[DE_ZIG_ZAG[k]] == 0) {
+      continue;
+    }
+    for (run = k - last - 1; run > 15; run -= 16) {
+      pack[n++] = (short)(15 << 12);
+    }
+    pack[n++] = (run << 12) | (block[DE_ZIG_ZAG[k]] & 0xfff);
+    last = k;
+  }
+  if (last < 63) {
+    pack[n++] = 0;
+  }
+  return n;
+}
+
+/* Once every scan of a progressive or arithmetic coded frame has been
+    decoded, convert the accumulated coefficients of the MCUs in the crop
+    region to the requested output. */
+static void xjpeg_finish_prog(xjpeg_decode_ctx *ctx, image *img,
+ xjpeg_decode_out out) {
+  xjpeg_region crop;
+  xjpeg_block_queue queue;
+  int index;
+  int mby;
+  int mbx;
+  int i;
+  xjpeg_frame_crop(ctx, &crop);
+  queue.nblocks = 0;
+  index = 0;
+  for (mby = crop.y0; mby < crop.y1; mby++) {
+    for (mbx = crop.x0; mbx < crop.x1; mbx++) {
+      for (i = 0; i < ctx->frame.ncomps; i++) {
+        xjpeg_comp_info *pi;
+        image_plane *ip;
+        xjpeg_quant *quant;
+        int sby;
+        int sbx;
+        pi = &ctx->frame.comp[i];
+        ip = &img->plane[i];
+        quant = &ctx->quant[pi->tq];
+        for (sby = 0; sby < pi->vsamp; sby++) {
+          for (sbx = 0; sbx < pi->hsamp; sbx++) {
+            int by;
+            int bx;
+            short *block;
+            short *dst;
+            int j;
+            by = mby*pi->vsamp + sby;
+            bx = mbx*pi->hsamp + sbx;
+            block = ctx->coef_comp[i] + by*ctx->coef_stride[i] + (bx << 6);
+            /* The position of the block in the image */
+            by -= crop.y0*pi->vsamp;
+            bx -= crop.x0*pi->hsamp;
+            dst = ip->coef + by*(ip->width << (3 + ctx->scale)) +
+             (bx << 6);
+            switch (out) {
+              case XJPEG_DECODE_PACK : {
+                ip->index[by*(ip->ystride >> 3) + bx] = index;
+                j = xjpeg_pack_block(block, img->coef + index);
+                ip->packed += j;
+                index += j;
+                break;
+              }
+              case XJPEG_DECODE_QUANT : {
+                if (dst != block) {
+                  memcpy(dst, block, 64*sizeof(short));
+                }
+                break;
+              }
+              case XJPEG_DECODE_DCT : {
+                for (j = 0; j < 64; j++) {
+                  dst[j] = block[j]*quant->tbl[j];
+                }
+                break;
+              }
+              case XJPEG_DECODE_YUV : {
+                short *tmp;
+                int last;
+                last = 63;
+                while (last > 0 && block[DE_ZIG_ZAG[last]] == 0) last--;
+                tmp = queue.block[queue.nblocks];
+                memcpy(tmp, block, 64*sizeof(short));
+                xjpeg_queue_block(ctx, &queue, tmp, quant, last, ip->data +
+                 (by*ip->ystride << (3 - ctx->scale)) +
+                 (bx*ip->xstride << (3 - ctx->scale)), ip->ystride);
+                break;
+              }
+              default : {
+                fprintf(stderr, "Unsupported output %i\n", out);
+              }
+            }
+          }
+        }
+      }
+    }
+  }
+  xjpeg_flush_blocks(&queue);
+}
+
+/* Read the SOS marker segment and find the image planes its components are
+    decoded to. */
+static void xjpeg_decode_sos_header(xjpeg_decode_ctx *ctx, image *img,
+ image_plane *plane[NPLANES_MAX]) {
+  unsigned short len;
+  xjpeg_scan_header *scan;
+  int i, j;
+  unsigned char byte;
+  int dc_table;
+  int ac_table;
+  XJPEG_DECODE_SHORT(ctx, len);
+  len -= 2;
+  XJPEG_ERROR(ctx, len < 6, "Error SOS needs at least 6 bytes");
+  scan = &ctx->scan;
+  scan->valid = 1;
+  XJPEG_DECODE_BYTE(ctx, scan->ncomps);
+  XJPEG_ERROR(ctx, scan->ncomps == 0 || scan->ncomps > 4,
+   "Error SOS expected Ns value 1 to 4.");
+  len--;
+  XJPEG_ERROR(ctx, scan->ncomps > ctx->frame.ncomps,
+   "Error SOS has more components than the frame.");
+  for (i = 0; i < scan->ncomps; i++) {
+    xjpeg_scan_comp *comp;
+    comp = &scan->comp[i];
+    XJPEG_DECODE_BYTE(ctx, comp->id);
+    plane[i] = NULL;
+    for (j = 0; j < ctx->frame.ncomps; j++) {
+      if (ctx->frame.comp[j].id == comp->id) {
+        plane[i] = &img->plane[j];
+        comp->ci = j;
+        break;
+      }
+    }
+    XJPEG_ERROR(ctx, !plane[i], "Error SOS references invalid component.");
+    XJPEG_DECODE_BYTE(ctx, byte);
+    comp->td = byte >> 4;
+    comp->ta = byte & 0x7;
+    len -= 2;
+  }
+  /* A scan of a single component is not interleaved and codes only the
+      blocks covering the component's own samples, one block per MCU */
+  if (scan->ncomps == 1) {
+    int bw;
+    int bh;
+    xjpeg_comp_blocks(ctx, &ctx->frame.comp[scan->comp[0].ci], &bw, &bh);
+    scan->nhmb = bw;
+    scan->nvmb = bh;
+    scan->comp[0].hsamp = 1;
+    scan->comp[0].vsamp = 1;
+  }
+  else {
+    scan->nhmb = ctx->frame.nhmb;
+    scan->nvmb = ctx->frame.nvmb;
+    for (i = 0; i < scan->ncomps; i++) {
+      scan->comp[i].hsamp = ctx->frame.comp[scan->comp[i].ci].hsamp;
+      scan->comp[i].vsamp = ctx->frame.comp[scan->comp[i].ci].vsamp;
+    }
+  }
+  xjpeg_frame_crop(ctx, &scan->crop);
+  if (scan->ncomps == 1) {
+    xjpeg_comp_info *pi;
+    pi = &ctx->frame.comp[scan->comp[0].ci];
+    scan->crop.x0 *= pi->hsamp;
+    scan->crop.y0 *= pi->vsamp;
+    scan->crop.x1 = GLJ_MINI(scan->crop.x1*pi->hsamp, scan->nhmb);
+    scan->crop.y1 = GLJ_MINI(scan->crop.y1*pi->vsamp, scan->nvmb);
+  }
+  XJPEG_DECODE_BYTE(ctx, scan->ss);
+  XJPEG_DECODE_BYTE(ctx, scan->se);
+  XJPEG_DECODE_BYTE(ctx, byte);
+  scan->ah = byte >> 4;
+  scan->al = byte & 0xf;
+  len -= 3;
+  XJPEG_ERROR(ctx, len != 0, "Error decoding SOS, unprocessed bytes.");
+  if (ctx->frame.progressive) {
+    XJPEG_ERROR(ctx, scan->ss > scan->se || scan->se > 63,
+     "Error SOS invalid spectral selection.");
+    XJPEG_ERROR(ctx, scan->ss == 0 && scan->se != 0,
+     "Error SOS DC scan must not contain AC coefficients.");
+    XJPEG_ERROR(ctx, scan->ss != 0 && scan->ncomps != 1,
+     "Error SOS AC scan must contain a single component.");
+    XJPEG_ERROR(ctx, scan->ah != 0 && scan->al != scan->ah - 1,
+     "Error SOS invalid successive approximation.");
+    XJPEG_ERROR(ctx, scan->al > 13, "Error SOS expected Al value 0 to 13.");
+    /* Only the first DC scan and the AC scans use an entropy table */
+    dc_table = scan->ss == 0 && scan->ah == 0;
+    ac_table = scan->ss != 0;
+  }
+  else {
+    XJPEG_ERROR(ctx, scan->ss != 0, "Error SOS expected Ss value 0.");
+    XJPEG_ERROR(ctx, scan->se != 63, "Error SOS expected Se value 63.");
+    XJPEG_ERROR(ctx, scan->ah != 0, "Error SOS expected Ah value 0.");
+    XJPEG_ERROR(ctx, scan->al != 0, "Error SOS expected Al value 0.");
+    dc_table = 1;
+    ac_table = 1;
+  }
+  (void)dc_table;
+  (void)ac_table;
+  for (i = 0; i < scan->ncomps; i++) {
+    if (ctx->frame.arithmetic) {
+      /* Conditioning tables always have a default value */
+      XJPEG_ERROR(ctx, scan->comp[i].td > 3 || scan->comp[i].ta > 3,
+       "Error SOS component references invalid conditioning table.");
+      continue;
+    }
+    XJPEG_ERROR(ctx, dc_table && !ctx->dc_huff[scan->comp[i].td].valid,
+     "Error SOS component references invalid DC entropy table.");
+    XJPEG_ERROR(ctx, ac_table && !ctx->ac_huff[scan->comp[i].ta].valid,
+     "Error SOS component references invalid AC entropy table.");
+  }
+}
+
+static void xjpeg_decode_sos(xjpeg_decode_ctx *ctx, image *img,
+ xjpeg_decode_out out) {
+  image_plane *plane[NPLANES_MAX];
+  xjpeg_decode_sos_header(ctx, img, plane);
+  if (ctx->error) {
+    return;
+  }
+  XJPEG_ERROR(ctx, ctx->scale < 0 || ctx->scale > 3,
+   "Error, scale must be from 0 to 3.");
+  XJPEG_ERROR(ctx, ctx->scale != 0 && out != XJPEG_DECODE_YUV,
+   "Error, only the yuv output can be scaled.");
+  switch (out) {
+    case XJPEG_DECODE_PACK :
+    case XJPEG_DECODE_QUANT :
+    case XJPEG_DECODE_DCT :
+    case XJPEG_DECODE_YUV : {
+      /* Arithmetic coded scans are decoded to coefficients like those of a
+          progressive frame, so the outputs are produced by the same code */
+      if (ctx->frame.progressive || ctx->frame.arithmetic) {
+        if (ctx->coef == NULL) {
+          xjpeg_coef_init(ctx, img, out);
+          if (ctx->coef == NULL) {
+            return;
+          }
+        }
+        /* At a scale of 1/8 only the DC coefficients are used, so the AC
+            scans of a progressive frame are stepped over unread */
+        if (ctx->frame.progressive && ctx->scan.ss != 0 && ctx->scale == 3) {
+          xjpeg_skip_scan(ctx);
+          break;
+        }
+        xjpeg_decode_prog_scan(ctx);
+      }
+      else if (ctx->scan.ncomps < ctx->frame.ncomps) {
+        xjpeg_defer_scan(ctx, img, plane, out);
+      }
+      else {
+        xjpeg_decode_scan(ctx, img->coef, plane, out);
+      }
+      break;
+    }
+    default : {
+      XJPEG_ERROR(ctx, 1, "Error, unsupported output format.");
+    }
+  }
+}
+
+static void xjpeg_skip_marker(xjpeg_decode_ctx *ctx) {
+  unsigned short len;
+  XJPEG_DECODE_SHORT(ctx, len);
+  XJPEG_LOG(("Skipping %i bytes\n", len - 2));
+  XJPEG_SKIP_BYTES(ctx, len - 2);
+}
+
+/* Process a marker segment, or the entropy coded data of a scan following an
+    SOS marker. */
+static void xjpeg_decode_marker(xjpeg_decode_ctx *ctx, unsigned char marker,
+ image *img, xjpeg_decode_out out) {
+  XJPEG_LOG(("Marker %02X\n", marker));
+  switch (marker) {
+    /* Start of Image */
+    case 0xD8 : {
+      xjpeg_decode_soi(ctx);
+      break;
+    }
+    /* End of Image */
+    case 0xD9 : {
+      xjpeg_decode_eoi(ctx);
+      break;
+    }
+    /* Quantization Tables */
+    case 0xDB : {
+      xjpeg_decode_dqt(ctx);
+      break;
+    }
+    /* Huffman Tables */
+    case 0xC4 : {
+      xjpeg_decode_dht(ctx);
+      break;
+    }
+    /* Arithmetic Coding Conditioning */
+    case 0xCC : {
+      xjpeg_decode_dac(ctx);
+      break;
+    }
+    /* Start of Frame (SOF0 Baseline DCT) */
+    case 0xC0 : {
+      xjpeg_decode_sof(ctx, 0, 0);
+      break;
+    }
+    /* Start of Frame (SOF2 Progressive DCT) */
+    case 0xC2 : {
+      xjpeg_decode_sof(ctx, 1, 0);
+      break;
+    }
+    /* Start of Frame (SOF9 Extended Sequential DCT, Arithmetic) */
+    case 0xC9 : {
+      xjpeg_decode_sof(ctx, 0, 1);
+      break;
+    }
+    /* Start of Frame (SOF10 Progressive DCT, Arithmetic) */
+    case 0xCA : {
+      xjpeg_decode_sof(ctx, 1, 1);
+      break;
+    }
+    /* Restart Interval */
+    case 0xDD : {
+      xjpeg_decode_rsi(ctx);
+      break;
+    }
+    /* Start of Scans */
+    case 0xDA : {
+      xjpeg_decode_sos(ctx, img, out);
+      break;
+    }
+    default : {
+      xjpeg_skip_marker(ctx);
+      break;
+    }
+  }
+}
+
+static void xjpeg_decode(xjpeg_decode_ctx *ctx, int headers_only, image *img,
+ xjpeg_decode_out out) {
+  while (!ctx->error && !ctx->end_of_image) {
+    unsigned char marker;
+    marker = ctx->marker;
+    ctx->marker = 0;
+    if (marker == 0) {
+      XJPEG_ERROR(ctx, ctx->size < 2, "Error underflow reading marker.");
+      XJPEG_ERROR(ctx, ctx->pos[0] != 0xFF, "Error, invalid JPEG syntax.");
+      XJPEG_SKIP_BYTES(ctx, 1);
+      XJPEG_DECODE_BYTE(ctx, marker);
+    }
+    if (headers_only && marker == 0xDA) {
+      ctx->marker = marker;
+      break;
+    }
+    xjpeg_decode_marker(ctx, marker, img, out);
+  }
+}
+
+void xjpeg_decode_header(xjpeg_decode_ctx *ctx) {
+  xjpeg_decode(ctx, 1, NULL, (xjpeg_decode_out)0);
+}
+
+/* Decode the scans set aside until the end of the image and produce the
+    output of a progressive or arithmetic coded frame. */
+static void xjpeg_finish_image(xjpeg_decode_ctx *ctx, image *img,
+ xjpeg_decode_out out) {
+  if (ctx->deferred != NULL) {
+    if (!ctx->error) {
+      xjpeg_decode_deferred_scans(ctx, img);
+    }
+    free(ctx->deferred);
+    ctx->deferred = NULL;
+    ctx->ndeferred = 0;
+  }
+  if (ctx->coef != NULL) {
+    if (!ctx->error) {
+      xjpeg_finish_prog(ctx, img, out);
+    }
+    if (ctx->coef != img->coef) {
+      free(ctx->coef);
+    }
+    ctx->coef = NULL;
+  }
+}
+
+typedef struct xjpeg_convert xjpeg_convert;
+
+/* The rows of yuv samples to convert to pixels, in bands of whole MCUs */
+struct xjpeg_convert {
+  image *img;
+  glj_pixel_format format;
+  /* The distance in bytes between rows of pixels */
+  int stride;
+  int y0;
+  int y1;
+  int band;
+};
+
+static void xjpeg_convert_band(void *ctx, int thread, int task) {
+  xjpeg_convert *conv;
+  image *img;
+  image_plane *ip;
+  int y;
+  int end;
+  (void)thread;
+  conv = (xjpeg_convert *)ctx;
+  img = conv->img;
+  ip = img->plane;
+  y = conv->y0 + task*conv->band;
+  end = GLJ_MINI(y + conv->band, conv->y1);
+  while (y < end) {
+    unsigned char *pixels;
+    int nrows;
+    pixels = img->pixels + y*conv->stride;
+    nrows = 1;
+    if (img->nplanes == 1) {
+      /* Grey rgb output keeps one byte per pixel, as libjpeg's does */
+      if (conv->format == GLJ_PIXEL_RGB) {
+        memcpy(pixels, ip[0].data + y*ip[0].ystride, img->width);
+      }
+      else {
+        glj_grey_rgb_row(pixels, ip[0].data + y*ip[0].ystride, img->width,
+         conv->format);
+      }
+    }
+    else {
+      int c;
+      /* Two rows of luma share each row of vertically subsampled chroma */
+      if (ip[1].ydec && y + 1 < end) {
+        nrows = 2;
+      }
+      c = (y >> ip[1].ydec)*ip[1].ystride;
+      GLJ_YCC_RGB_ROWS(pixels, conv->stride, ip[0].data + y*ip[0].ystride,
+       ip[0].ystride, nrows, ip[1].data + c, ip[2].data + c, ip[1].xdec,
+       img->width, conv->format);
+    }
+    y += nrows;
+  }
+}
+
+/* Convert the rows of MCUs [start, end) of the yuv planes of img to pixels,
+    with a band of rows of MCUs for each task. */
+static void xjpeg_convert_image(xjpeg_decode_ctx *ctx, image *img,
+ xjpeg_decode_out out, int start, int end) {
+  xjpeg_convert conv;
+  int mcu_height;
+  int nbands;
+  if (img->plane[0].xdec || img->plane[0].ydec || (img->nplanes == 3 &&
+   (img->plane[1].xdec != img->plane[2].xdec ||
+   img->plane[1].ydec != img->plane[2].ydec))) {
+    ctx->error = "Error, unsupported subsampling for rgb output.";
+    return;
+  }
+  mcu_height = (ctx->frame.vmax << 3) >> ctx->scale;
+  conv.img = img;
+  /* The pixel formats are in the same order as the outputs */
+  conv.format = (glj_pixel_format)(out - XJPEG_DECODE_RGB);
+  conv.stride = img->width*(img->nplanes == 1 &&
+   conv.format == GLJ_PIXEL_RGB ? 1 : GLJ_PIXEL_SIZE[conv.format]);
+  if (img->pstride != 0) {
+    if (img->pstride < conv.stride) {
+      ctx->error = "Error, pixel stride is shorter than a row of pixels.";
+      return;
+    }
+    conv.stride = img->pstride;
+  }
+  conv.y0 = start*mcu_height;
+  conv.y1 = GLJ_MINI(end*mcu_height, img->height);
+  if (conv.y0 >= conv.y1) {
+    return;
+  }
+  conv.band = mcu_height*GLJ_MAXI(1, 16/mcu_height);
+  nbands = (conv.y1 - conv.y0 + conv.band - 1)/conv.band;
+  glj_run_tasks(xjpeg_convert_band, &conv, nbands, ctx->nthreads);
+}
+
+/* The pixel outputs are decoded to yuv and then converted */
+static xjpeg_decode_out xjpeg_decode_planes(xjpeg_decode_out out) {
+  return out >= XJPEG_DECODE_RGB ? XJPEG_DECODE_YUV : out;
+}
+
+/* Start counting the packed values of each plane from zero, as an image
+    may be decoded to again, e.g., every frame of jpeg_gpu.
+   The packed values of deferred scans are placed after those counted so
+    far, so a stale count would place them past the end of image.coef. */
+static void xjpeg_reset_packed(image *img) {
+  int i;
+  for (i = 0; i < img->nplanes; i++) {
+    img->plane[i].packed = 0;
+  }
+}
+
+void xjpeg_decode_image(xjpeg_decode_ctx *ctx, image *img,
+ xjpeg_decode_out out) {
+  xjpeg_reset_packed(img);
+  xjpeg_decode(ctx, 0, img, xjpeg_decode_planes(out));
+  xjpeg_finish_image(ctx, img, xjpeg_decode_planes(out));
+  if (out >= XJPEG_DECODE_RGB && !ctx->error) {
+    xjpeg_convert_image(ctx, img, out, 0, ctx->frame.nvmb);
+  }
+}
+
+static void xjpeg_init_ctx(xjpeg_decode_ctx *ctx) {
+  memset(ctx, 0, sizeof(xjpeg_decode_ctx));
+  ctx->nthreads = glj_thread_count();
+  /* The default conditioning used when there is no DAC marker (F.1.4.4) */
+  memset(ctx->arith_dc_u, 1, sizeof(ctx->arith_dc_u));
+  memset(ctx->arith_ac_k, 5, sizeof(ctx->arith_ac_k));
+}
+
+void xjpeg_init(xjpeg_decode_ctx *ctx, const unsigned char *buf, int size) {
+  xjpeg_init_ctx(ctx);
+  ctx->pos = buf;
+  ctx->size = size;
   /* check that this is a valid JPEG file by looking for SOI marker. */
   XJPEG_ERROR(ctx,
    ctx->pos[0] != 0xFF || ctx->pos[1] != 0xD8 || ctx->pos[2] != 0xFF,
    "Error, not a JPEG (invalid SOI marker).");
 }
+
+/* Convert the offsets of the index entries from bits in the destuffed data
+    of the scan to bits in the file data starting at pos, by walking the same
+    bytes xjpeg_destuff() did. */
+static void xjpeg_index_stuffed(xjpeg_index *index, const unsigned char *pos) {
+  const unsigned char *p;
+  long n;
+  int k;
+  p = pos;
+  n = 0;
+  for (k = 0; k < index->nentries; k++) {
+    xjpeg_index_entry *entry;
+    entry = &index->entry[k];
+    for (;;) {
+      /* Step over the fill bytes and RSTn markers, which are not data */
+      while (p[0] == 0xFF && (p[1] == 0xFF || (p[1] & 0xF8) == 0xD0)) {
+        p += p[1] == 0xFF ? 1 : 2;
+      }
+      if (n == entry->pos >> 3) {
+        break;
+      }
+      p += p[0] == 0xFF ? 2 : 1;
+      n++;
+    }
+    entry->pos = ((long)(p - pos) << 3) | (entry->pos & 0x7);
+  }
+}
+
+/* The 32 bit FNV-1a hash of the size bytes in buf */
+static unsigned long xjpeg_index_hash(const unsigned char *buf, int size) {
+  unsigned long hash;
+  int i;
+  hash = 0x811C9DC5;
+  for (i = 0; i < size; i++) {
+    hash = ((hash ^ buf[i])*0x01000193) & 0xFFFFFFFF;
+  }
+  return hash;
+}
+
+int xjpeg_index_build(xjpeg_index *index, const unsigned char *buf, int size,
+ int interval) {
+  xjpeg_decode_ctx *ctx;
+  image img;
+  image_plane *plane[NPLANES_MAX];
+  xjpeg_mcu mcu;
+  unsigned char *data;
+  int *rst;
+  const unsigned char *scan;
+  const unsigned char *end;
+  int len;
+  int m;
+  int k;
+  memset(index, 0, sizeof(xjpeg_index));
+  ctx = (xjpeg_decode_ctx *)malloc(sizeof(xjpeg_decode_ctx));
+  if (ctx == NULL) {
+    return EXIT_FAILURE;
+  }
+  xjpeg_init(ctx, buf, size);
+  xjpeg_decode_header(ctx);
+  if (ctx->error || ctx->marker != 0xDA) {
+    free(ctx);
+    return EXIT_FAILURE;
+  }
+  ctx->marker = 0;
+  /* Only the image planes the scan would write to are looked up */
+  memset(&img, 0, sizeof(image));
+  xjpeg_decode_sos_header(ctx, &img, plane);
+  if (ctx->error || ctx->frame.progressive || ctx->frame.arithmetic ||
+   ctx->scan.ncomps != ctx->frame.ncomps) {
+    free(ctx);
+    return EXIT_FAILURE;
+  }
+  index->nmcus = ctx->scan.nhmb*ctx->scan.nvmb;
+  index->interval = interval > 0 ? interval : ctx->scan.nhmb;
+  if (ctx->restart_interval) {
+    index->interval = ctx->restart_interval;
+  }
+  index->nentries = (index->nmcus + index->interval - 1)/index->interval;
+  index->entry = (xjpeg_index_entry *)malloc(
+   index->nentries*sizeof(xjpeg_index_entry));
+  data = (unsigned char *)malloc(ctx->size + XJPEG_DESTUFF_PAD);
+  rst = (int *)malloc(index->nentries*sizeof(*rst));
+  if (index->entry == NULL || data == NULL || rst == NULL) {
+    free(rst);
+    free(data);
+    free(ctx);
+    xjpeg_index_clear(index);
+    return EXIT_FAILURE;
+  }
+  /* The symbols are decoded from a destuffed copy of the scan, where the
+      offset of the next unread bit is simply known from the bit reader */
+  rst[0] = 0;
+  if (xjpeg_destuff(ctx->pos, ctx->size, data, rst + 1, index->nentries - 1,
+   &end, &len) < index->nentries - 1 && ctx->restart_interval) {
+    ctx->error = "Error, missing RSTn marker.";
+  }
+  index->size = size;
+  index->hash = xjpeg_index_hash(buf, size);
+  index->scan = ctx->pos - buf;
+  index->end = end - buf;
+  scan = ctx->pos;
+  ctx->pos = data;
+  ctx->size = len + XJPEG_DESTUFF_PAD;
+  ctx->unstuffed = 1;
+  xjpeg_mcu_init(ctx, &mcu);
+  for (k = 0; k < index->nentries && !ctx->error; k++) {
+    xjpeg_index_entry *entry;
+    entry = &index->entry[k];
+    if (ctx->restart_interval) {
+      xjpeg_seek(ctx, data + rst[k], 0);
+      memset(mcu.dc_pred, 0, sizeof(mcu.dc_pred));
+    }
+    entry->pos = ((long)(ctx->pos - data) << 3) - ctx->bits;
+    memcpy(entry->dc_pred, mcu.dc_pred, sizeof(entry->dc_pred));
+    /* Past the end of the data the bit reader only returns zero padding */
+    if (entry->pos >= (long)len << 3) {
+      ctx->error = "Error, scan data ends before the last MCU.";
+      break;
+    }
+    m = GLJ_MINI((k + 1)*index->interval, index->nmcus);
+    for (m -= k*index->interval; m > 0 && !ctx->error; m--) {
+      xjpeg_skip_mcu(ctx, &mcu);
+    }
+  }
+  if (ctx->error) {
+    free(rst);
+    free(data);
+    free(ctx);
+    xjpeg_index_clear(index);
+    return EXIT_FAILURE;
+  }
+  xjpeg_index_stuffed(index, scan);
+  free(rst);
+  free(data);
+  free(ctx);
+  return EXIT_SUCCESS;
+}
+
+int xjpeg_index_match(const xjpeg_index *index, const unsigned char *buf,
+ int size) {
+  return index->size == size && index->hash == xjpeg_index_hash(buf, size);
+}
+
+/* The sidecar file starts with XJPEG_INDEX_MAGIC followed by the fields of
+    the index and then of each entry, all stored little-endian with the
+    number of bytes given below.
+   The magic changes with the layout, so that older files are rebuilt. */
+#define XJPEG_INDEX_MAGIC "XJI2"
+#define XJPEG_INDEX_HEADER (4 + 7*4)
+#define XJPEG_INDEX_ENTRY (8 + NCOMPS_MAX*2)
+
+/* Shift a byte at a time, never by the width of a 32-bit long, so that the
+    bytes of pos past that width are stored as zero. */
+static void xjpeg_index_put(unsigned char *buf, unsigned long value,
+ int nbytes) {
+  int i;
+  for (i = 0; i < nbytes; i++) {
+    buf[i] = (unsigned char)(value & 0xFF);
+    value >>= 8;
+  }
+}
+
+static long xjpeg_index_get(const unsigned char *buf, int nbytes) {
+  unsigned long value;
+  int i;
+  value = 0;
+  for (i = nbytes; i-- > 0; ) {
+    value = (value << 8) | buf[i];
+  }
+  /* Sign extend the 2 byte DC predictors */
+  if (nbytes == 2 && value >= 0x8000) {
+    return (long)value - 0x10000;
+  }
+  return (long)value;
+}
+
+int xjpeg_index_save(const xjpeg_index *index, const char *name) {
+  FILE *fp;
+  unsigned char buf[XJPEG_INDEX_HEADER];
+  int k;
+  fp = fopen(name, "wb");
+  if (fp == NULL) {
+    return EXIT_FAILURE;
+  }
+  memcpy(buf, XJPEG_INDEX_MAGIC, 4);
+  xjpeg_index_put(buf + 4, index->size, 4);
+  xjpeg_index_put(buf + 8, index->scan, 4);
+  xjpeg_index_put(buf + 12, index->end, 4);
+  xjpeg_index_put(buf + 16, index->nmcus, 4);
+  xjpeg_index_put(buf + 20, index->interval, 4);
+  xjpeg_index_put(buf + 24, index->nentries, 4);
+  xjpeg_index_put(buf + 28, index->hash, 4);
+  fwrite(buf, 1, XJPEG_INDEX_HEADER, fp);
+  for (k = 0; k < index->nentries; k++) {
+    int i;
+    xjpeg_index_put(buf, index->entry[k].pos, 8);
+    for (i = 0; i < NCOMPS_MAX; i++) {
+      xjpeg_index_put(buf + 8 + 2*i, index->entry[k].dc_pred[i], 2);
+    }
+    fwrite(buf, 1, XJPEG_INDEX_ENTRY, fp);
+  }
+  if (fclose(fp) != 0) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+int xjpeg_index_load(xjpeg_index *index, const char *name) {
+  FILE *fp;
+  unsigned char buf[XJPEG_INDEX_HEADER];
+  long pos;
+  int k;
+  memset(index, 0, sizeof(xjpeg_index));
+  fp = fopen(name, "rb");
+  if (fp == NULL) {
+    return EXIT_FAILURE;
+  }
+  if (fread(buf, 1, XJPEG_INDEX_HEADER, fp) != (size_t)XJPEG_INDEX_HEADER ||
+   memcmp(buf, XJPEG_INDEX_MAGIC, 4) != 0) {
+    fclose(fp);
+    return EXIT_FAILURE;
+  }
+  index->size = xjpeg_index_get(buf + 4, 4);
+  index->scan = xjpeg_index_get(buf + 8, 4);
+  index->end = xjpeg_index_get(buf + 12, 4);
+  index->nmcus = xjpeg_index_get(buf + 16, 4);
+  index->interval = xjpeg_index_get(buf + 20, 4);
+  index->nentries = xjpeg_index_get(buf + 24, 4);
+  index->hash = (unsigned long)xjpeg_index_get(buf + 28, 4) & 0xFFFFFFFF;
+  if (index->scan >= index->end || index->end >= index->size ||
+   index->nmcus <= 0 || index->interval <= 0 || index->nentries !=
+   (index->nmcus - 1)/index->interval + 1) {
+    fclose(fp);
+    memset(index, 0, sizeof(xjpeg_index));
+    return EXIT_FAILURE;
+  }
+  index->entry = (xjpeg_index_entry *)malloc(
+   index->nentries*sizeof(xjpeg_index_entry));
+  if (index->entry == NULL) {
+    fclose(fp);
+    memset(index, 0, sizeof(xjpeg_index));
+    return EXIT_FAILURE;
+  }
+  /* Every entry must be inside the scan and follow the one before it, so
+      that decoding from it stays in bounds */
+  pos = -1;
+  for (k = 0; k < index->nentries; k++) {
+    xjpeg_index_entry *entry;
+    int i;
+    entry = &index->entry[k];
+    if (fread(buf, 1, XJPEG_INDEX_ENTRY, fp) != (size_t)XJPEG_INDEX_ENTRY) {
+      break;
+    }
+    entry->pos = xjpeg_index_get(buf, 8);
+    for (i = 0; i < NCOMPS_MAX; i++) {
+      entry->dc_pred[i] = (short)xjpeg_index_get(buf + 8 + 2*i, 2);
+    }
+    if (entry->pos <= pos || entry->pos >> 3 >= index->end - index->scan) {
+      break;
+    }
+    pos = entry->pos;
+  }
+  fclose(fp);
+  if (k < index->nentries) {
+    xjpeg_index_clear(index);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
+
+void xjpeg_index_clear(xjpeg_index *index) {
+  free(index->entry);
+  memset(index, 0, sizeof(xjpeg_index));
+}
+
+/* The bytes kept past the data pushed to a stream: a fake EOI marker, where
+    the bit reader stops when it runs out of data, then zeros so that a whole
+    word can always be loaded. */
+#define XJPEG_STREAM_PAD ((int)(2 + 2*sizeof(xjpeg_decode_word)))
+
+#define XJPEG_STREAM_ALLOC (4096)
+
+struct xjpeg_stream {
+  /* Every byte pushed so far, followed by XJPEG_STREAM_PAD bytes */
+  unsigned char *buf;
+  int size;
+  int alloc;
+  /* The offset in buf up to which the entropy coded data of the next scan
+      has been searched for its end */
+  int find;
+  /* Has the SOS marker of the first scan been found */
+  int header;
+  /* The image passed to xjpeg_stream_image() */
+  image *img;
+  /* Is an interleaved baseline scan being decoded a row of MCUs at a time */
+  int scan;
+  image_plane *plane[NPLANES_MAX];
+  /* The state of the scan at the next MCU to decode, including the DC
+      predictors and the next free offset in the pack buffer */
+  xjpeg_mcu mcu;
+  int mcu_pos;
+  int rst_counter;
+  /* Is a restart marker expected before the next MCU */
+  int rst;
+  /* The number of rows of MCUs completely decoded */
+  int rows;
+};
+
+/* Return the number of bytes pushed that have not been read yet. */
+static int xjpeg_stream_avail(const xjpeg_decode_ctx *ctx) {
+  return (int)(ctx->stream->buf + ctx->stream->size - ctx->pos);
+}
+
+/* Write the padding after the data pushed so far and extend the bit readers
+    of the current and deferred scans up to its end. */
+static void xjpeg_stream_pad(xjpeg_decode_ctx *ctx) {
+  xjpeg_stream *st;
+  unsigned char *end;
+  int k;
+  st = ctx->stream;
+  end = st->buf + st->size;
+  memset(end, 0, XJPEG_STREAM_PAD);
+  end[0] = 0xFF;
+  end[1] = 0xD9;
+  end += XJPEG_STREAM_PAD;
+  ctx->size = (int)(end - ctx->pos);
+  for (k = 0; k < ctx->ndeferred; k++) {
+    ctx->deferred[k].ctx.size = (int)(end - ctx->deferred[k].ctx.pos);
+  }
+}
+
+/* Can the scan whose SOS marker segment begins at seg be decoded a row of
+    MCUs at a time as the data arrives.
+   Other scans are decoded once all of their entropy coded data is available.
+    */
+static int xjpeg_stream_rows(const xjpeg_decode_ctx *ctx,
+ const unsigned char *seg) {
+  return !ctx->frame.progressive && !ctx->frame.arithmetic &&
+   seg[2] == ctx->frame.ncomps;
+}
+
+/* Decode the MCUs of an interleaved baseline scan up to the end of the data
+    pushed so far.
+   Each row of MCUs, or restart interval if shorter, is decoded from a saved
+    copy of the bit reader and MCU state.
+   If the bit reader reaches the padding the state is restored, so the same
+    MCUs are decoded again once more data has been pushed. */
+static void xjpeg_stream_scan(xjpeg_decode_ctx *ctx, xjpeg_decode_out out) {
+  xjpeg_stream *st;
+  xjpeg_scan_header *scan;
+  int nmcus;
+  int i;
+  st = ctx->stream;
+  scan = &ctx->scan;
+  nmcus = scan->nhmb*scan->nvmb;
+  while (st->mcu_pos < nmcus) {
+    const unsigned char *pos;
+    int size;
+    xjpeg_decode_word bitbuf;
+    int bits;
+    unsigned char marker;
+    xjpeg_mcu mcu;
+    int end;
+    if (st->rst) {
+      if (xjpeg_stream_avail(ctx) < 2) {
+        return;
+      }
+      xjpeg_decode_rst(ctx, &st->mcu, st->rst_counter);
+      if (ctx->error) {
+        return;
+      }
+      if (ctx->marker == 0xD9) {
+        break;
+      }
+      st->rst_counter++;
+      st->rst = 0;
+    }
+    end = GLJ_MINI((st->mcu_pos/scan->nhmb + 1)*scan->nhmb, nmcus);
+    if (ctx->restart_interval) {
+      end = GLJ_MINI(end,
+       (st->mcu_pos/ctx->restart_interval + 1)*ctx->restart_interval);
+    }
+    pos = ctx->pos;
+    size = ctx->size;
+    bitbuf = ctx->bitbuf;
+    bits = ctx->bits;
+    marker = ctx->marker;
+    memcpy(&mcu, &st->mcu, sizeof(xjpeg_mcu));
+    xjpeg_decode_mcus(ctx, &st->mcu, st->img->coef, st->plane, out,
+     st->mcu_pos, end);
+    /* Any error may come from the zero bits past the end of the data */
+    if (ctx->marker && ctx->pos >= st->buf + st->size - 1) {
+      ctx->error = NULL;
+      ctx->pos = pos;
+      ctx->size = size;
+      ctx->bitbuf = bitbuf;
+      ctx->bits = bits;
+      ctx->marker = marker;
+      memcpy(&st->mcu, &mcu, sizeof(xjpeg_mcu));
+      return;
+    }
+    if (ctx->error) {
+      return;
+    }
+    st->mcu_pos = end;
+    st->rows = end/scan->nhmb;
+    if (end == nmcus) {
+      /* As xjpeg_end_scan(), but fill bytes are skipped before the next
+          marker once they have been pushed */
+      ctx->bitbuf = 0;
+      ctx->bits = 0;
+      ctx->marker = 0;
+    }
+    else if (ctx->restart_interval && end % ctx->restart_interval == 0) {
+      st->rst = 1;
+    }
+  }
+  for (i = 0; i < scan->ncomps; i++) {
+    st->plane[i]->packed += st->mcu.packed[i];
+  }
+  st->scan = 0;
+}
+
+/* As xjpeg_decode(), but stop rather than read past the data pushed so far.
+   A marker is only processed once its whole segment has been pushed. */
+static void xjpeg_stream_decode(xjpeg_decode_ctx *ctx, int headers_only,
+ image *img, xjpeg_decode_out out) {
+  xjpeg_stream *st;
+  st = ctx->stream;
+  while (!ctx->error && !ctx->end_of_image) {
+    const unsigned char *p;
+    unsigned char marker;
+    int avail;
+    int len;
+    if (st->scan) {
+      xjpeg_stream_scan(ctx, out);
+      if (st->scan) {
+        break;
+      }
+      continue;
+    }
+    marker = ctx->marker;
+    if (marker == 0) {
+      /* Skip any fill bytes before the marker (B.1.1.2) */
+      while (xjpeg_stream_avail(ctx) >= 2 && ctx->pos[0] == 0xFF &&
+       ctx->pos[1] == 0xFF) {
+        XJPEG_SKIP_BYTES(ctx, 1);
+      }
+      if (xjpeg_stream_avail(ctx) < 2) {
+        break;
+      }
+      marker = ctx->pos[1];
+      p = ctx->pos + 2;
+    }
+    else {
+      p = ctx->pos;
+    }
+    avail = (int)(st->buf + st->size - p);
+    if (marker != 0xD8 && marker != 0xD9) {
+      if (avail < 2) {
+        break;
+      }
+      len = (p[0] << 8) | p[1];
+      if (avail < len) {
+        break;
+      }
+      if (marker == 0xDA && !headers_only && !xjpeg_stream_rows(ctx, p)) {
+        const unsigned char *start;
+        const unsigned char *end;
+        /* Resume the search for the end of the scan where it stopped */
+        start = st->buf + GLJ_MAXI((int)(p + len - st->buf), st->find);
+        xjpeg_find_rst(start, ctx->size - (int)(start - ctx->pos), NULL, 0,
+         &end);
+        if (end >= st->buf + st->size - 1) {
+          st->find = st->size - 1;
+          break;
+        }
+      }
+    }
+    if (ctx->marker == 0) {
+      XJPEG_ERROR(ctx, ctx->pos[0] != 0xFF, "Error, invalid JPEG syntax.");
+      XJPEG_SKIP_BYTES(ctx, 2);
+    }
+    ctx->marker = 0;
+    st->find = 0;
+    if (marker == 0xDA) {
+      if (headers_only) {
+        ctx->marker = marker;
+        st->header = 1;
+        break;
+      }
+      if (xjpeg_stream_rows(ctx, ctx->pos)) {
+        xjpeg_decode_sos_header(ctx, img, st->plane);
+        XJPEG_ERROR(ctx, out > XJPEG_DECODE_YUV,
+         "Error, unsupported output format.");
+        xjpeg_mcu_init(ctx, &st->mcu);
+        xjpeg_mcu_blocks(ctx, &st->mcu, st->plane);
+        st->mcu_pos = 0;
+        st->rst_counter = 0;
+        st->rst = 0;
+        st->scan = 1;
+        continue;
+      }
+    }
+    xjpeg_decode_marker(ctx, marker, img, out);
+  }
+}
+
+int xjpeg_stream_init(xjpeg_decode_ctx *ctx) {
+  xjpeg_stream *st;
+  xjpeg_init_ctx(ctx);
+  st = (xjpeg_stream *)malloc(sizeof(xjpeg_stream));
+  if (st == NULL) {
+    return EXIT_FAILURE;
+  }
+  memset(st, 0, sizeof(xjpeg_stream));
+  st->alloc = XJPEG_STREAM_ALLOC;
+  st->buf = (unsigned char *)malloc(st->alloc);
+  if (st->buf == NULL) {
+    free(st);
+    return EXIT_FAILURE;
+  }
+  ctx->stream = st;
+  ctx->pos = st->buf;
+  xjpeg_stream_pad(ctx);
+  return EXIT_SUCCESS;
+}
+
+int xjpeg_stream_push(xjpeg_decode_ctx *ctx, const unsigned char *buf,
+ int size) {
+  xjpeg_stream *st;
+  st = ctx->stream;
+  if (st->size + size + XJPEG_STREAM_PAD > st->alloc) {
+    unsigned char *tmp;
+    int alloc;
+    int k;
+    for (alloc = st->alloc; st->size + size + XJPEG_STREAM_PAD > alloc; ) {
+      alloc *= 2;
+    }
+    tmp = (unsigned char *)malloc(alloc);
+    if (tmp == NULL) {
+      return EXIT_FAILURE;
+    }
+    memcpy(tmp, st->buf, st->size);
+    /* Move the bit readers, which point into the old buffer */
+    ctx->pos = tmp + (ctx->pos - st->buf);
+    for (k = 0; k < ctx->ndeferred; k++) {
+      xjpeg_decode_ctx *dc;
+      dc = &ctx->deferred[k].ctx;
+      dc->pos = tmp + (dc->pos - st->buf);
+    }
+    free(st->buf);
+    st->buf = tmp;
+    st->alloc = alloc;
+  }
+  memcpy(st->buf + st->size, buf, size);
+  st->size += size;
+  xjpeg_stream_pad(ctx);
+  return EXIT_SUCCESS;
+}
+
+int xjpeg_stream_header(xjpeg_decode_ctx *ctx) {
+  if (!ctx->stream->header) {
+    xjpeg_stream_decode(ctx, 1, NULL, (xjpeg_decode_out)0);
+  }
+  return ctx->stream->header;
+}
+
+int xjpeg_stream_image(xjpeg_decode_ctx *ctx, image *img,
+ xjpeg_decode_out out) {
+  xjpeg_stream *st;
+  int rows;
+  st = ctx->stream;
+  if (st->img == NULL) {
+    xjpeg_reset_packed(img);
+  }
+  st->img = img;
+  rows = st->rows;
+  xjpeg_stream_decode(ctx, 0, img, xjpeg_decode_planes(out));
+  if (ctx->end_of_image) {
+    xjpeg_finish_image(ctx, img, xjpeg_decode_planes(out));
+    st->rows = ctx->frame.nvmb;
+  }
+  /* Only the rows of MCUs completed by this chunk are converted */
+  if (out >= XJPEG_DECODE_RGB && !ctx->error) {
+    xjpeg_convert_image(ctx, img, out, rows, st->rows);
+  }
+  return st->rows;
+}
+
+void xjpeg_stream_clear(xjpeg_decode_ctx *ctx) {
+  xjpeg_stream *st;
+  st = ctx->stream;
+  free(ctx->deferred);
+  ctx->deferred = NULL;
+  ctx->ndeferred = 0;
+  if (ctx->coef != NULL && ctx->coef != st->img->coef) {
+    free(ctx->coef);
+  }
+  ctx->coef = NULL;
+  free(st->buf);
+  free(st);
+  ctx->stream = NULL;
+}
@@ -22,6 +22,20 @@ See the License for the specific language governing permissions and limitations
 # define NHUFF_MAX (4)
 # define NCOMPS_MAX (3)
 
+/* The number of bits of a codeword decoded with a single table lookup, from 9
+    to 11 */
+# if !defined(XJPEG_LOOKUP_BITS)
+#  define XJPEG_LOOKUP_BITS (10)
+# endif
+
+/* The size of the second level lookup tables for codewords longer than
+    XJPEG_LOOKUP_BITS.
+   Codewords are assigned in order, so every second level table of 2^n
+    entries but the last is a full subtree holding at least n + 1 of the 256
+    codewords, plus two entries are reserved for invalid codewords. */
+# define XJPEG_SUB_MAX \
+ (((256/(17 - XJPEG_LOOKUP_BITS) + 1) << (16 - XJPEG_LOOKUP_BITS)) + 2)
+
 typedef struct xjpeg_quant xjpeg_quant;
 
 struct xjpeg_quant {
@@ -31,6 +45,8 @@ struct xjpeg_quant {
   unsigned char bits;
   /* The loaded quantization table, in zig-zag order */
   unsigned short tbl[64];
+  /* tbl with the scales of the float inverse DCT folded in */
+  float scaled[64];
 };
 
 typedef struct xjpeg_huff xjpeg_huff;
@@ -51,16 +67,26 @@ struct xjpeg_huff {
 
   /* Lookup tables used for fast decoding of the most common (shortest)
       codewords.
-     For each codeword of up to 8-bits, an entry is placed in all indeces where
-      the codeword is the proper prefix of the index, e.g., for codeword 010101
-      there would be four entries at indeces 010101{00,01,10,11}.
-     Each entry in lookup[] is the is a packed unsigned short where the high
-      unsigned byte is the length of the codeword in bits and the low unsigned
-      byte is the symbol.
-     When the codeword is longer than 8 bits the low unsigned byte is unused.*/
-  int lookup[256];
-  int index[16];
-  int maxcode[16];
+     For each codeword of up to XJPEG_LOOKUP_BITS bits, an entry is placed in
+      all indeces where the codeword is the proper prefix of the index, e.g.,
+      with 8 lookup bits for codeword 010101 there would be four entries at
+      indeces 010101{00,01,10,11}.
+     Each entry in lookup[] is the length of the codeword in bits shifted up
+      by 16, or'ed with the symbol.
+     When the index is the prefix of longer codewords, the length is that of
+      the longest of them and the low 16 bits are the offset in sub[] of a
+      second level table, indexed by the codeword bits past the prefix.
+     Each entry in sub[] is the length of the codeword shifted up by 8, or'ed
+      with the symbol.*/
+  int lookup[1 << XJPEG_LOOKUP_BITS];
+  unsigned short sub[XJPEG_SUB_MAX];
+  int nsub;
+  /* For AC tables, a second lookup table that also decodes the coefficient
+      when both the codeword and its magnitude bits fit in XJPEG_LOOKUP_BITS.
+     Each entry is the signed coefficient value times 65536, plus the symbol
+      shifted up by 8, plus the total number of bits, or 0 if the coefficient
+      must be decoded using lookup[]. */
+  int ac_lookup[1 << XJPEG_LOOKUP_BITS];
 };
 
 typedef struct xjpeg_comp_info xjpeg_comp_info;
@@ -84,16 +110,39 @@ struct xjpeg_frame_header {
   unsigned short height;
   unsigned short nhmb;
   unsigned short nvmb;
+  /* The maximum horizontal and vertical sampling factors */
+  unsigned char hmax;
+  unsigned char vmax;
+  /* Is this a progressive DCT frame (SOF2, SOF10) */
+  int progressive;
+  /* Is the entropy coded data arithmetic coded (SOF9, SOF10) */
+  int arithmetic;
+};
+
+typedef struct xjpeg_region xjpeg_region;
+
+/* A rectangle of MCUs [x0, x1) x [y0, y1) */
+struct xjpeg_region {
+  unsigned short x0;
+  unsigned short y0;
+  unsigned short x1;
+  unsigned short y1;
 };
 
 typedef struct xjpeg_scan_comp xjpeg_scan_comp;
 
 struct xjpeg_scan_comp {
   unsigned char id;
+  /* Index of this component in the frame header */
+  unsigned char ci;
   /* DC entropy coding table index */
   unsigned char td;
   /* AC entropy coding table index */
   unsigned char ta;
+  /* The number of blocks of this component in an MCU of the scan, a single
+      block when the scan is not interleaved (A.2.2) */
+  unsigned char hsamp;
+  unsigned char vsamp;
 };
 
 typedef struct xjpeg_scan_header xjpeg_scan_header;
@@ -102,10 +151,69 @@ struct xjpeg_scan_header {
   int valid;
   unsigned char ncomps;
   xjpeg_scan_comp comp[NCOMPS_MAX];
+  /* Spectral selection start and end, in zig-zag order */
+  unsigned char ss;
+  unsigned char se;
+  /* Successive approximation bit position high and low */
+  unsigned char ah;
+  unsigned char al;
+  /* The number of horizontal and vertical MCUs in the scan */
+  unsigned short nhmb;
+  unsigned short nvmb;
+  /* The MCUs of the scan inside the crop region */
+  xjpeg_region crop;
 };
 
 typedef size_t xjpeg_decode_word;
 
+typedef struct xjpeg_index_entry xjpeg_index_entry;
+
+/* The decoder state at the start of an MCU, from which the scan can be
+    decoded without reading any of the data before it */
+struct xjpeg_index_entry {
+  /* The offset in bits of the MCU from the start of the entropy coded data of
+      the scan, i.e., the offset of its first byte shifted up by 3, or'ed with
+      the bit in that byte it starts at */
+  long pos;
+  short dc_pred[NCOMPS_MAX];
+};
+
+typedef struct xjpeg_index xjpeg_index;
+
+/* An index of a baseline frame coded as a single interleaved scan, with an
+    entry every interval MCUs.
+   Scans with restart intervals have an entry at the start of each one. */
+struct xjpeg_index {
+  /* The size of the jpeg file, a hash of all of its bytes, so that an index
+      of another file of the same size is not used, and the offset in it of
+      the entropy coded data of the scan and of the marker that follows it */
+  long size;
+  unsigned long hash;
+  long scan;
+  long end;
+  int nmcus;
+  int interval;
+  int nentries;
+  xjpeg_index_entry *entry;
+};
+
+/* The inverse DCT used to reconstruct the blocks of full scale
+    XJPEG_DECODE_YUV planes */
+typedef enum xjpeg_idct {
+  /* The float transform of the GPU decoder */
+  XJPEG_IDCT_FLOAT,
+  /* The integer transform of libjpeg's JDCT_ISLOW, which gives the same
+      samples as the libjpeg decoder */
+  XJPEG_IDCT_ISLOW,
+  XJPEG_IDCT_MAX
+} xjpeg_idct;
+
+extern const char *XJPEG_IDCT_NAMES[XJPEG_IDCT_MAX];
+
+typedef struct xjpeg_deferred_scan xjpeg_deferred_scan;
+
+typedef struct xjpeg_stream xjpeg_stream;
+
 typedef struct xjpeg_decode_ctx xjpeg_decode_ctx;
 
 struct xjpeg_decode_ctx {
@@ -118,16 +226,64 @@ struct xjpeg_decode_ctx {
   xjpeg_decode_word bitbuf;
   /* Number of bits available in bitbuf */
   int bits;
+  /* Is the data being read free of stuffed zero bytes and markers */
+  int unstuffed;
 
   xjpeg_quant quant[NQUANT_MAX];
   xjpeg_huff dc_huff[NHUFF_MAX];
   xjpeg_huff ac_huff[NHUFF_MAX];
   short restart_interval;
+  /* The arithmetic coding conditioning tables, the lower and upper bounds L
+      and U of the DC difference categories and the AC threshold Kx */
+  unsigned char arith_dc_l[NHUFF_MAX];
+  unsigned char arith_dc_u[NHUFF_MAX];
+  unsigned char arith_ac_k[NHUFF_MAX];
   xjpeg_frame_header frame;
   xjpeg_scan_header scan;
 
+  /* The MCUs of the frame that are decoded to the image, which only holds
+      this region, or the whole frame when empty */
+  xjpeg_region crop;
+
+  /* The log2 of the factor the XJPEG_DECODE_YUV planes are scaled down by,
+      from 0 to 3, which must match the image.scale they were allocated with.
+     Each block is reconstructed from only its low frequency coefficients. */
+  int scale;
+  /* The inverse DCT of full scale blocks, scaled down ones always use the
+      reduced float transforms */
+  xjpeg_idct idct;
+
+  /* Quantized coefficients accumulated across the scans of a progressive
+      frame, either in image.coef or, when only part of the frame is output,
+      a separate buffer covering the whole frame */
+  short *coef;
+  /* The start of each frame component in coef and the distance in
+      coefficients between its rows of blocks */
+  short *coef_comp[NCOMPS_MAX];
+  int coef_stride[NCOMPS_MAX];
+
   const char *error;
 
+  /* Number of worker threads used to decode scans with restart intervals */
+  int nthreads;
+  /* The number of jobs decoded so far with their entropy decoding overlapped
+      with reconstruction by xjpeg_decode_pipelined() */
+  int npipelined;
+
+  /* An index of the scan built from the same file, not owned by the
+      decoder, or NULL.
+     When set, the scan is decoded as one job per entry on ctx->nthreads
+      workers, and entries with no MCUs in the crop region are not read. */
+  xjpeg_index *index;
+
+  /* Non-interleaved baseline scans waiting to be decoded concurrently */
+  xjpeg_deferred_scan *deferred;
+  int ndeferred;
+
+  /* The data pushed so far and the state of a suspended scan, when decoding
+      from a stream */
+  xjpeg_stream *stream;
+
   int start_of_image;
   int end_of_image;
   unsigned char marker;
@@ -138,7 +294,9 @@ typedef enum xjpeg_decode_out {
   XJPEG_DECODE_QUANT,
   XJPEG_DECODE_DCT,
   XJPEG_DECODE_YUV,
-  XJPEG_DECODE_RGB
+  XJPEG_DECODE_RGB,
+  XJPEG_DECODE_RGBA,
+  XJPEG_DECODE_BGRA
 } xjpeg_decode_out;
 
 void xjpeg_init(xjpeg_decode_ctx *ctx, const unsigned char *buf, int size);
@@ -146,4 +304,38 @@ void xjpeg_decode_header(xjpeg_decode_ctx *ctx);
 void xjpeg_decode_image(xjpeg_decode_ctx *ctx, image *img,
  xjpeg_decode_out out);
 
+/* Incremental decoding of a jpeg file that arrives in chunks, e.g., from a
+    socket or a pipe.
+   Each chunk is appended with xjpeg_stream_push(), then the decoder resumes
+    from where the previous chunk ran out.
+   xjpeg_stream_header() returns non-zero once the headers up to the first
+    scan have been decoded, after which the image can be allocated.
+   xjpeg_stream_image() returns the number of rows of MCUs of the image that
+    are complete.
+   Interleaved baseline scans are decoded a row of MCUs at a time, other scans
+    once all of their data has arrived and the image is only complete at EOI.
+   Errors are reported in ctx->error as for xjpeg_decode_image(). */
+int xjpeg_stream_init(xjpeg_decode_ctx *ctx);
+int xjpeg_stream_push(xjpeg_decode_ctx *ctx, const unsigned char *buf,
+ int size);
+int xjpeg_stream_header(xjpeg_decode_ctx *ctx);
+int xjpeg_stream_image(xjpeg_decode_ctx *ctx, image *img,
+ xjpeg_decode_out out);
+void xjpeg_stream_clear(xjpeg_decode_ctx *ctx);
+
+/* Build an index of the jpeg file in buf by decoding only the symbols of its
+    scan, with an entry every interval MCUs, or every row of MCUs when
+    interval is 0.
+   Returns EXIT_FAILURE if the file is not a baseline frame whose first scan
+    holds every component, or its data is corrupt. */
+int xjpeg_index_build(xjpeg_index *index, const unsigned char *buf, int size,
+ int interval);
+/* Returns non-zero if index was built from the jpeg file in buf. */
+int xjpeg_index_match(const xjpeg_index *index, const unsigned char *buf,
+ int size);
+/* Save and load an index to and from a small sidecar file. */
+int xjpeg_index_save(const xjpeg_index *index, const char *name);
+int xjpeg_index_load(xjpeg_index *index, const char *name);
+void xjpeg_index_clear(xjpeg_index *index);
+
 #endif
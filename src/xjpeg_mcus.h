@@ -0,0 +1,74 @@
+/* JPEG GPU project
+Copyright (c) 2014-2016 JPEG GPU project contributors.  All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ use this file except in compliance with the License.
+You may obtain a copy of the License at:
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed
+ under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+ CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and limitations
+ under the License. */
+
+/* Template for the MCU decoding loops of a baseline scan, included by xjpeg.c
+    once per output format so that the format specific work is selected at
+    compile time rather than for every coefficient.
+   Before including define XJPEG_MCUS_NAME, the name of the function to
+    generate, and XJPEG_MCUS_OUT, the xjpeg_decode_out it writes.
+   A loop is generated for each of the common MCU layouts, and the function
+    dispatches on the number of blocks in an MCU once per call. */
+
+#define XJPEG_MCUS_FUNC XJPEG_PASTE(XJPEG_MCUS_NAME, _1)
+#define XJPEG_MCUS_NBLOCKS (1)
+#include "xjpeg_mcus_loop.h"
+
+#define XJPEG_MCUS_FUNC XJPEG_PASTE(XJPEG_MCUS_NAME, _3)
+#define XJPEG_MCUS_NBLOCKS (3)
+#include "xjpeg_mcus_loop.h"
+
+#define XJPEG_MCUS_FUNC XJPEG_PASTE(XJPEG_MCUS_NAME, _4)
+#define XJPEG_MCUS_NBLOCKS (4)
+#include "xjpeg_mcus_loop.h"
+
+#define XJPEG_MCUS_FUNC XJPEG_PASTE(XJPEG_MCUS_NAME, _6)
+#define XJPEG_MCUS_NBLOCKS (6)
+#include "xjpeg_mcus_loop.h"
+
+#define XJPEG_MCUS_FUNC XJPEG_PASTE(XJPEG_MCUS_NAME, _n)
+#define XJPEG_MCUS_NBLOCKS (mcu->nblocks_mcu)
+#include "xjpeg_mcus_loop.h"
+
+static void XJPEG_MCUS_NAME(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu,
+ short *pack, image_plane *plane[NPLANES_MAX], int start, int end) {
+  switch (mcu->nblocks_mcu) {
+    /* Monochrome, or a single component scan */
+    case 1 : {
+      XJPEG_PASTE(XJPEG_MCUS_NAME, _1)(ctx, mcu, pack, plane, start, end);
+      break;
+    }
+    /* 4:4:4 */
+    case 3 : {
+      XJPEG_PASTE(XJPEG_MCUS_NAME, _3)(ctx, mcu, pack, plane, start, end);
+      break;
+    }
+    /* 4:2:2 and 4:4:0 */
+    case 4 : {
+      XJPEG_PASTE(XJPEG_MCUS_NAME, _4)(ctx, mcu, pack, plane, start, end);
+      break;
+    }
+    /* 4:2:0 */
+    case 6 : {
+      XJPEG_PASTE(XJPEG_MCUS_NAME, _6)(ctx, mcu, pack, plane, start, end);
+      break;
+    }
+    default : {
+      XJPEG_PASTE(XJPEG_MCUS_NAME, _n)(ctx, mcu, pack, plane, start, end);
+    }
+  }
+}
+
+#undef XJPEG_MCUS_NAME
+#undef XJPEG_MCUS_OUT
@@ -0,0 +1,184 @@
+/* JPEG GPU project
+Copyright (c) 2014-2016 JPEG GPU project contributors.  All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ use this file except in compliance with the License.
+You may obtain a copy of the License at:
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed
+ under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+ CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and limitations
+ under the License. */
+
+/* Template for the MCU decoding loop of a baseline scan, included by
+    xjpeg_mcus.h once per MCU layout.
+   Before including define XJPEG_MCUS_FUNC, the name of the function to
+    generate, XJPEG_MCUS_OUT, the xjpeg_decode_out it writes, and
+    XJPEG_MCUS_NBLOCKS, the number of blocks in an MCU.
+   The destination of every block relative to the start of its MCU is
+    precomputed in mcu->block, and when XJPEG_MCUS_NBLOCKS is a constant the
+    loop over them can be unrolled by the compiler. */
+
+static void XJPEG_MCUS_FUNC(xjpeg_decode_ctx *ctx, xjpeg_mcu *mcu,
+ short *pack, image_plane *plane[NPLANES_MAX], int start, int end) {
+  xjpeg_block_queue queue;
+  short coef[64];
+  int m;
+  queue.nblocks = 0;
+  for (m = start; m < end; m++) {
+    int mbx;
+    int mby;
+    int coef_off[NCOMPS_MAX];
+    int data_off[NCOMPS_MAX];
+    int index_off[NCOMPS_MAX];
+    int n;
+    int i;
+    mby = m/ctx->scan.nhmb;
+    mbx = m - mby*ctx->scan.nhmb;
+    for (i = 0; i < ctx->scan.ncomps; i++) {
+      coef_off[i] = mby*mcu->row[i].coef + mbx*mcu->col[i].coef;
+      data_off[i] = mby*mcu->row[i].data + mbx*mcu->col[i].data;
+      index_off[i] = mby*mcu->row[i].index + mbx*mcu->col[i].index;
+    }
+    for (n = 0; n < XJPEG_MCUS_NBLOCKS; n++) {
+      xjpeg_mcu_block *mb;
+      image_plane *ip;
+      short *block;
+      unsigned char symbol;
+      short value;
+      int last;
+      int j;
+      mb = &mcu->block[n];
+      i = mb->comp;
+      ip = plane[i];
+      /* Coefficients are decoded straight into the image, and a yuv block
+          into the queue, where it can wait to be dequantized and
+          reconstructed together with others, or deferred to another thread.
+         Packed values only go to pack, so that block is never cleared. */
+      switch (XJPEG_MCUS_OUT) {
+        case XJPEG_DECODE_QUANT :
+        case XJPEG_DECODE_DCT : {
+          block = ip->coef + coef_off[i] + mb->off.coef;
+          break;
+        }
+        case XJPEG_DECODE_YUV : {
+          block = mcu->defer != NULL ? mcu->defer[mcu->ndefer].coef :
+           queue.block[queue.nblocks];
+          break;
+        }
+        default : {
+          block = coef;
+        }
+      }
+      if (XJPEG_MCUS_OUT != XJPEG_DECODE_PACK) {
+        memset(block, 0, 64*sizeof(short));
+      }
+      XJPEG_DECODE_VLC(ctx, mcu->dc_huff[i], symbol, value);
+      XJPEG_LOG(("dc = %i\n", value));
+      mcu->dc_pred[i] += value;
+      XJPEG_LOG(("dc_pred = %i\n", mcu->dc_pred[i]));
+      j = 0;
+      switch (XJPEG_MCUS_OUT) {
+        case XJPEG_DECODE_PACK : {
+          ip->index[index_off[i] + mb->off.index] = mcu->index;
+          mcu->packed[i]++;
+          pack[mcu->index] = mcu->dc_pred[i] & 0xfff;
+          mcu->index++;
+          break;
+        }
+        case XJPEG_DECODE_QUANT :
+        case XJPEG_DECODE_YUV : {
+          block[0] = mcu->dc_pred[i];
+          break;
+        }
+        default : {
+          block[0] = mcu->dc_pred[i]*mcu->quant[i]->tbl[0];
+        }
+      }
+      do {
+        XJPEG_DECODE_AC(ctx, mcu->ac_huff[i], symbol, value);
+        if (symbol) {
+          j += (symbol >> 4) + 1;
+          XJPEG_LOG(("j = %i, offset = %i, value = %i, dequant = %i\n", j,
+           (symbol >> 4) + 1, value, value*mcu->quant[i]->tbl[j]));
+          XJPEG_ERROR(ctx, j > 63, "Error indexing outside block.");
+          /* Without validation, keep the writes inside the block when the
+              data is corrupt or ends early, e.g., the zero bits decoded past
+              the end of a stream */
+          switch (XJPEG_MCUS_OUT) {
+            case XJPEG_DECODE_PACK : {
+              mcu->packed[i]++;
+              pack[mcu->index] =
+               (((symbol >> 4) & 0xf) << 12) | (value & 0xfff);
+              mcu->index++;
+              break;
+            }
+            case XJPEG_DECODE_QUANT :
+            case XJPEG_DECODE_YUV : {
+              block[DE_ZIG_ZAG[j & 63]] = value;
+              break;
+            }
+            default : {
+              block[DE_ZIG_ZAG[j & 63]] =
+               value*mcu->quant[i]->tbl[DE_ZIG_ZAG[j & 63]];
+            }
+          }
+        }
+        else {
+          if (XJPEG_MCUS_OUT == XJPEG_DECODE_PACK) {
+            mcu->packed[i]++;
+            pack[mcu->index] = 0;
+            mcu->index++;
+          }
+          XJPEG_LOG(("****************** EOB at j = %i\n\n", j));
+          break;
+        }
+      }
+      while (j < 63);
+      /* Every coefficient after the last one coded is zero.
+         Like the writes above, this stays inside the block when j runs past
+          63 on corrupt data or the zero bits decoded past the end of a
+          stream. */
+      last = GLJ_MINI(j, 63);
+#if LOGGING_ENABLED
+      for (j = 1; j <= 64; j++) {
+        XJPEG_LOG(("%5i%s", block[j - 1], j & 0x7 ? ", " : "\n"));
+      }
+#endif
+      switch (XJPEG_MCUS_OUT) {
+        case XJPEG_DECODE_PACK :
+        case XJPEG_DECODE_QUANT :
+        case XJPEG_DECODE_DCT : {
+          break;
+        }
+        case XJPEG_DECODE_YUV : {
+          if (mcu->defer != NULL) {
+            xjpeg_coef_block *cb;
+            cb = &mcu->defer[mcu->ndefer++];
+            cb->quant = mcu->quant[i];
+            cb->last = last;
+            cb->data = ip->data + data_off[i] + mb->off.data;
+            cb->ystride = ip->ystride;
+            break;
+          }
+          xjpeg_queue_block(ctx, &queue, block, mcu->quant[i], last,
+           ip->data + data_off[i] + mb->off.data, ip->ystride);
+          break;
+        }
+        default : {
+          fprintf(stderr, "Unsupported output %i\n", XJPEG_MCUS_OUT);
+        }
+      }
+    }
+    XJPEG_LOG(("mbx = %i, mby = %i\n", mbx, mby));
+  }
+  if (XJPEG_MCUS_OUT == XJPEG_DECODE_YUV) {
+    xjpeg_flush_blocks(&queue);
+  }
+}
+
+#undef XJPEG_MCUS_FUNC
+#undef XJPEG_MCUS_NBLOCKS
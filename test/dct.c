@@ -1,6 +1,8 @@
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
+#include <time.h>
 #include "../src/dct.h"
 #include "../src/internal.h"
 #include "../src/logging.h"
@@ -116,8 +118,11 @@ static void idct8x8(double *x, int xstride, const double *y, int ystride) {
   for (i = 0; i < 8; i++) idct8(x + i, xstride, t + 8*i);
 }
 
-static void ieee1180_block(long pme[8*8], long pmse[8*8], int ppe[8*8],
- int low, int high, int sign) {
+typedef void (*idct8x8_func)(short *x, int xstride, const short *y,
+ int ystride);
+
+static void ieee1180_block(idct8x8_func idct, long pme[8*8], long pmse[8*8],
+ int ppe[8*8], int low, int high, int sign) {
   short img[8*8];
   double dct[8*8];
   short ref[8*8];
@@ -138,7 +143,7 @@ static void ieee1180_block(long pme[8*8], long pmse[8*8], int ppe[8*8],
     }
   }
   idct8x8(dct, 8, dct, 8);
-  glj_real_idct8x8(img, 8, img, 8);
+  (*idct)(img, 8, img, 8);
   for (j = 0; j < 8; j++) {
     for (i = 0; i < 8; i++) {
       ref[8*j + i] = GLJ_CLAMPI(-256, (int)floor(dct[8*j + i] + 0.5), 255);
@@ -156,8 +161,10 @@ static void ieee1180_block(long pme[8*8], long pmse[8*8], int ppe[8*8],
   }
 }
 
+/* The worst mean square error must be at most mse, which can be tighter than
+    the 0.06 of the spec. */
 static void ieee1180_test(long pme[8*8], long pmse[8*8], int ppe[8*8], int low,
- int high, int sign) {
+ int high, int sign, double mse) {
   int j;
   int i;
   int m;
@@ -196,8 +203,8 @@ static void ieee1180_test(long pme[8*8], long pmse[8*8], int ppe[8*8], int low,
   total /= 8*8;
   GLJ_LOG((GLJ_LOG_TEST, GLJ_LOG_DEBUG,
    "Worst mean square error = %.6f (%s spec limit 0.06)", max,
-   IEEE1180_TEST(max <= 0.015)));
-  GLJ_TEST(max <= 0.015);
+   IEEE1180_TEST(max <= mse)));
+  GLJ_TEST(max <= mse);
   GLJ_LOG((GLJ_LOG_TEST, GLJ_LOG_DEBUG,
    "Overall mean square error = %.6f (%s spec limit 0.02)", total,
    IEEE1180_TEST(max <= 0.02)));
@@ -226,23 +233,22 @@ static void ieee1180_test(long pme[8*8], long pmse[8*8], int ppe[8*8], int low,
   GLJ_TEST(total <= 0.0015);
 }
 
-static void test_idct8_ieee1180(void *ctx) {
+static void ieee1180_run(idct8x8_func idct, double mse) {
   int i;
   long pme[8*8];
   long pmse[8*8];
   int ppe[8*8];
   int n;
   short dct[8*8];
-  (void)ctx;
   ieee1180_srand(1);
   for (i = 0; i < IEEE1180_NRANGES; i++) {
     memset(pme, 0, sizeof(pme));
     memset(pmse, 0, sizeof(pmse));
     memset(ppe, 0, sizeof(ppe));
     for (n = 0; n < IEEE1180_NBLOCKS; n++) {
-      ieee1180_block(pme, pmse, ppe, IEEE1180_L[i], IEEE1180_H[i], 1);
+      ieee1180_block(idct, pme, pmse, ppe, IEEE1180_L[i], IEEE1180_H[i], 1);
     }
-    ieee1180_test(pme, pmse, ppe, IEEE1180_L[i], IEEE1180_H[i], 1);
+    ieee1180_test(pme, pmse, ppe, IEEE1180_L[i], IEEE1180_H[i], 1, mse);
   }
   ieee1180_srand(1);
   for (i = 0; i < IEEE1180_NRANGES; i++) {
@@ -250,18 +256,305 @@ static void test_idct8_ieee1180(void *ctx) {
     memset(pmse, 0, sizeof(pmse));
     memset(ppe, 0, sizeof(ppe));
     for (n = 0; n < IEEE1180_NBLOCKS; n++) {
-      ieee1180_block(pme, pmse, ppe, IEEE1180_L[i], IEEE1180_H[i], -1);
+      ieee1180_block(idct, pme, pmse, ppe, IEEE1180_L[i], IEEE1180_H[i], -1);
     }
-    ieee1180_test(pme, pmse, ppe, IEEE1180_L[i], IEEE1180_H[i], -1);
+    ieee1180_test(pme, pmse, ppe, IEEE1180_L[i], IEEE1180_H[i], -1,
+     mse);
   }
   memset(dct, 0, sizeof(dct));
-  glj_real_idct8x8(dct, 8, dct, 8);
+  (*idct)(dct, 8, dct, 8);
   for (n = 0, i = 0; i < 8*8; i++) n += GLJ_ABSI(dct[i]);
   GLJ_TEST(n == 0);
 }
 
+static void test_idct8_ieee1180(void *ctx) {
+  (void)ctx;
+  ieee1180_run(glj_real_idct8x8, 0.015);
+}
+
+static void test_islow_idct8_ieee1180(void *ctx) {
+  (void)ctx;
+  ieee1180_run(glj_islow_idct8x8, 0.06);
+#if defined(GLJ_HAVE_SSE2)
+  ieee1180_run(glj_islow_idct8x8_sse2, 0.06);
+#endif
+}
+
+/* Compute the NxN samples of a block scaled down by 8/N from its top-left NxN
+    coefficients, using the 8-point normalization. */
+static void idct_reduced(double *x, int n, const short *y) {
+  double pi;
+  int j;
+  int i;
+  int v;
+  int u;
+  pi = acos(-1);
+  for (j = 0; j < n; j++) {
+    for (i = 0; i < n; i++) {
+      x[j*n + i] = 0;
+      for (v = 0; v < n; v++) {
+        for (u = 0; u < n; u++) {
+          x[j*n + i] += (v ? 0.5 : 0.5/sqrt(2))*(u ? 0.5 : 0.5/sqrt(2))*
+           cos((2*j + 1)*v*pi/(2*n))*cos((2*i + 1)*u*pi/(2*n))*y[v*8 + u];
+        }
+      }
+    }
+  }
+}
+
+static void test_idct_reduced(void *ctx) {
+  int b;
+  int n;
+  int m;
+  (void)ctx;
+  ieee1180_srand(1);
+  m = 0;
+  for (b = 0; b < IEEE1180_NBLOCKS; b++) {
+    short dct[8*8];
+    short test[4*4];
+    double ref[4*4];
+    int i;
+    for (i = 0; i < 8*8; i++) {
+      dct[i] = ieee1180_random(-300, 300);
+    }
+    for (n = 4; n >= 1; n >>= 1) {
+      switch (n) {
+        case 4 : {
+          glj_real_idct4x4(test, 4, dct, 8);
+          break;
+        }
+        case 2 : {
+          glj_real_idct2x2(test, 2, dct, 8);
+          break;
+        }
+        default : {
+          glj_real_idct1x1(test, dct);
+        }
+      }
+      idct_reduced(ref, n, dct);
+      for (i = 0; i < n*n; i++) {
+        m = GLJ_MAXI(m, GLJ_ABSI(test[i] - (int)floor(ref[i] + 0.5)));
+      }
+    }
+  }
+  GLJ_LOG((GLJ_LOG_TEST, GLJ_LOG_DEBUG,
+   "Worst peak error of reduced iDCTs = %i", m));
+  GLJ_TEST(m <= 1);
+}
+
+/* The sparse iDCTs must give exactly the samples of glj_real_idct8x8(). */
+static void test_idct8x8_sparse(void *ctx) {
+  int b;
+  int n;
+  int m;
+  (void)ctx;
+  ieee1180_srand(1);
+  m = 0;
+  for (b = 0; b < IEEE1180_NBLOCKS; b++) {
+    for (n = 4; n >= 1; n >>= 1) {
+      short dct[8*8];
+      short ref[8*8];
+      short test[8*8];
+      int j;
+      int i;
+      memset(dct, 0, sizeof(dct));
+      for (j = 0; j < n; j++) {
+        for (i = 0; i < n; i++) {
+          dct[8*j + i] = ieee1180_random(-2048, 2047);
+        }
+      }
+      glj_real_idct8x8(ref, 8, dct, 8);
+      switch (n) {
+        case 4 : {
+          glj_real_idct8x8_4x4(test, 8, dct, 8);
+          break;
+        }
+        case 2 : {
+          glj_real_idct8x8_2x2(test, 8, dct, 8);
+          break;
+        }
+        default : {
+          glj_real_idct8x8_dc(test, dct);
+          for (i = 1; i < 8*8; i++) test[i] = test[0];
+        }
+      }
+      for (i = 0; i < 8*8; i++) m += test[i] != ref[i];
+    }
+  }
+  GLJ_LOG((GLJ_LOG_TEST, GLJ_LOG_DEBUG,
+   "Samples that differ in the sparse iDCTs = %i", m));
+  GLJ_TEST(m == 0);
+}
+
+#if defined(GLJ_HAVE_SSE2)
+/* The SIMD ISLOW iDCT must give exactly the samples of the portable one. */
+static void test_islow_idct8_sse2(void *ctx) {
+  int b;
+  int m;
+  (void)ctx;
+  ieee1180_srand(1);
+  m = 0;
+  for (b = 0; b < IEEE1180_NBLOCKS; b++) {
+    short dct[8*8];
+    short ref[8*8];
+    short test[8*8];
+    int i;
+    for (i = 0; i < 8*8; i++) {
+      dct[i] = ieee1180_random(-2048, 2047) >> (b & 7);
+    }
+    glj_islow_idct8x8(ref, 8, dct, 8);
+    glj_islow_idct8x8_sse2(test, 8, dct, 8);
+    for (i = 0; i < 8*8; i++) m += test[i] != ref[i];
+  }
+  GLJ_LOG((GLJ_LOG_TEST, GLJ_LOG_DEBUG,
+   "Samples that differ in the SSE2 ISLOW iDCT = %i", m));
+  GLJ_TEST(m == 0);
+}
+#endif
+
+/* The fused iDCT must give the samples of dequantizing, glj_real_idct8x8(),
+    level shifting and clamping, to within the rounding of the prescaled
+    quantization table. */
+static void test_idct8x8_store(void *ctx) {
+  static short dct[GLJ_IDCT_BATCH_MAX*8*8];
+  static unsigned char test[GLJ_IDCT_BATCH_MAX*8*8];
+  unsigned short tbl[8*8];
+  float scaled[8*8];
+  int b;
+  int m;
+  int e;
+  (void)ctx;
+  ieee1180_srand(1);
+  m = 0;
+  e = 0;
+  for (b = 0; b < IEEE1180_NBLOCKS/GLJ_IDCT_BATCH_MAX; b++) {
+    unsigned char *x[GLJ_IDCT_BATCH_MAX];
+    int xstride[GLJ_IDCT_BATCH_MAX];
+    const short *y[GLJ_IDCT_BATCH_MAX];
+    const float *s[GLJ_IDCT_BATCH_MAX];
+    int n;
+    int i;
+    int j;
+    n = 1 + b%GLJ_IDCT_BATCH_MAX;
+    for (i = 0; i < 8*8; i++) {
+      tbl[i] = ieee1180_random(1, 16 << (b & 3));
+    }
+    glj_real_idct8x8_prescale(scaled, tbl);
+    for (i = 0; i < n*8*8; i++) {
+      dct[i] = ieee1180_random(-2048, 2047)/tbl[i & 63] >> (b & 7);
+    }
+    /* Every block is stored with a stride of 8*n, side by side */
+    for (i = 0; i < n; i++) {
+      x[i] = test + i*8;
+      xstride[i] = 8*n;
+      y[i] = dct + i*8*8;
+      s[i] = scaled;
+    }
+    glj_real_idct8x8_store(x, xstride, y, s, n);
+    for (i = 0; i < n; i++) {
+      short deq[8*8];
+      short ref[8*8];
+      for (j = 0; j < 8*8; j++) deq[j] = y[i][j]*tbl[j];
+      glj_real_idct8x8(ref, 8, deq, 8);
+      for (j = 0; j < 8*8; j++) {
+        int d;
+        d = x[i][(j >> 3)*xstride[i] + (j & 7)] - GLJ_CLAMP255(ref[j] + 128);
+        m += d != 0;
+        e += d < -1 || d > 1;
+      }
+    }
+  }
+  GLJ_LOG((GLJ_LOG_TEST, GLJ_LOG_DEBUG,
+   "Samples that differ in the fused iDCT = %i", m));
+  GLJ_TEST(e == 0);
+}
+
+# define IDCT_SPEED_NBLOCKS (1 << 20)
+
+static double idct_speed(idct8x8_func idct, const short *dct, int nblocks) {
+  short out[8*8];
+  clock_t start;
+  double secs;
+  int n;
+  start = clock();
+  for (n = 0; n < IDCT_SPEED_NBLOCKS; n++) {
+    (*idct)(out, 8, dct + (n%nblocks)*8*8, 8);
+  }
+  secs = (double)(clock() - start)/CLOCKS_PER_SEC;
+  return secs > 0 ? IDCT_SPEED_NBLOCKS/secs : 0;
+}
+
+/* Report the throughput of each full size iDCT in blocks per second. */
+static void test_idct8_speed(void *ctx) {
+  static short dct[256*8*8];
+  double speed;
+  int i;
+  (void)ctx;
+  ieee1180_srand(1);
+  for (i = 0; i < 256*8*8; i++) {
+    dct[i] = ieee1180_random(-300, 300);
+  }
+  speed = idct_speed(glj_real_idct8x8, dct, 256);
+  GLJ_LOG((GLJ_LOG_TEST, GLJ_LOG_INFO, "float iDCT: %.2f Mblocks/s",
+   speed*1e-6));
+  GLJ_TEST(speed > 0);
+  speed = idct_speed(glj_islow_idct8x8, dct, 256);
+  GLJ_LOG((GLJ_LOG_TEST, GLJ_LOG_INFO, "ISLOW iDCT: %.2f Mblocks/s",
+   speed*1e-6));
+  GLJ_TEST(speed > 0);
+  {
+    static const unsigned short tbl[8*8] = {
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1
+    };
+    float scaled[8*8];
+    unsigned char out[GLJ_IDCT_BATCH_MAX*8*8];
+    unsigned char *x[GLJ_IDCT_BATCH_MAX];
+    int xstride[GLJ_IDCT_BATCH_MAX];
+    const short *y[GLJ_IDCT_BATCH_MAX];
+    const float *s[GLJ_IDCT_BATCH_MAX];
+    clock_t start;
+    double secs;
+    int n;
+    glj_real_idct8x8_prescale(scaled, tbl);
+    for (i = 0; i < GLJ_IDCT_BATCH_MAX; i++) {
+      x[i] = out + i*8*8;
+      xstride[i] = 8;
+      s[i] = scaled;
+    }
+    start = clock();
+    for (n = 0; n < IDCT_SPEED_NBLOCKS; n += GLJ_IDCT_BATCH_MAX) {
+      for (i = 0; i < GLJ_IDCT_BATCH_MAX; i++) {
+        y[i] = dct + ((n + i)%256)*8*8;
+      }
+      glj_real_idct8x8_store(x, xstride, y, s, GLJ_IDCT_BATCH_MAX);
+    }
+    secs = (double)(clock() - start)/CLOCKS_PER_SEC;
+    speed = secs > 0 ? IDCT_SPEED_NBLOCKS/secs : 0;
+  }
+  GLJ_LOG((GLJ_LOG_TEST, GLJ_LOG_INFO, "float fused iDCT: %.2f Mblocks/s",
+   speed*1e-6));
+  GLJ_TEST(speed > 0);
+#if defined(GLJ_HAVE_SSE2)
+  speed = idct_speed(glj_islow_idct8x8_sse2, dct, 256);
+  GLJ_LOG((GLJ_LOG_TEST, GLJ_LOG_INFO, "ISLOW SSE2 iDCT: %.2f Mblocks/s",
+   speed*1e-6));
+  GLJ_TEST(speed > 0);
+#endif
+}
+
 static glj_test TESTS[] = {
- { "iDCT IEEE-1180 Test", test_idct8_ieee1180, 0, 0 }
+ { "iDCT IEEE-1180 Test", test_idct8_ieee1180, 0, 0 },
+ { "ISLOW iDCT IEEE-1180 Test", test_islow_idct8_ieee1180, 0, 0 },
+#if defined(GLJ_HAVE_SSE2)
+ { "ISLOW SSE2 iDCT Test", test_islow_idct8_sse2, 0, 0 },
+#endif
+ { "Reduced iDCT Test", test_idct_reduced, 0, 0 },
+ { "Sparse iDCT Test", test_idct8x8_sparse, 0, 0 },
+ { "Fused iDCT Test", test_idct8x8_store, 0, 0 },
+ { "iDCT Speed Test", test_idct8_speed, 0, 0 }
 };
 
 static glj_test_suite DCT_TEST_SUITE = {
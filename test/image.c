@@ -14,6 +14,8 @@ See the License for the specific language governing permissions and limitations
  under the License. */
 
 #include <stdlib.h>
+#include <string.h>
+#include "../src/color.h"
 #include "../src/image.h"
 #include "../src/jpeg_info.h"
 #include "../src/test.h"
@@ -38,6 +40,7 @@ static void test_image_init_8bit_420(void *ctx) {
   header.comp[2].vblocks = 2;
   header.comp[2].hsamp = 1;
   header.comp[2].vsamp = 1;
+  header.scale = 0;
   image_init(&img, &header);
   GLJ_TEST(img.plane[0].xdec == 0);
   GLJ_TEST(img.plane[0].ydec == 0);
@@ -54,8 +57,110 @@ static void test_image_init_8bit_420(void *ctx) {
   image_clear(&img);
 }
 
+static void test_image_init_8bit_420_scaled(void *ctx) {
+  jpeg_header header;
+  image img;
+  (void)ctx;
+  header.bits = 8;
+  header.width = 32;
+  header.height = 24;
+  header.ncomps = 3;
+  header.comp[0].hblocks = 4;
+  header.comp[0].vblocks = 4;
+  header.comp[0].hsamp = 2;
+  header.comp[0].vsamp = 2;
+  header.comp[1].hblocks = 2;
+  header.comp[1].vblocks = 2;
+  header.comp[1].hsamp = 1;
+  header.comp[1].vsamp = 1;
+  header.comp[2].hblocks = 2;
+  header.comp[2].vblocks = 2;
+  header.comp[2].hsamp = 1;
+  header.comp[2].vsamp = 1;
+  header.scale = 0;
+  GLJ_TEST(jpeg_header_scale(&header, 2) == EXIT_SUCCESS);
+  GLJ_TEST(header.width == 8);
+  GLJ_TEST(header.height == 6);
+  image_init(&img, &header);
+  GLJ_TEST(img.scale == 2);
+  GLJ_TEST(img.plane[0].width == 8);
+  GLJ_TEST(img.plane[0].height == 8);
+  GLJ_TEST(img.plane[0].ystride == 8);
+  GLJ_TEST(img.plane[1].width == 4);
+  GLJ_TEST(img.plane[1].height == 4);
+  GLJ_TEST(img.plane[1].xdec == 1);
+  GLJ_TEST(img.plane[1].ydec == 1);
+  image_clear(&img);
+}
+
+/* A few pixels worked out with the arithmetic of libjpeg's jdcolor.c */
+static void test_ycc_rgb(void *ctx) {
+  static const unsigned char Y[4] = { 128, 0, 255, 76 };
+  static const unsigned char CB[4] = { 128, 128, 0, 85 };
+  static const unsigned char CR[4] = { 128, 255, 255, 255 };
+  static const unsigned char RGB[4*3] = {
+    128, 128, 128, 178, 0, 0, 255, 208, 28, 254, 0, 0
+  };
+  unsigned char x[4*4];
+  int i;
+  (void)ctx;
+  glj_ycc_rgb_rows(x, 0, Y, 0, 1, CB, CR, 0, 4, GLJ_PIXEL_RGB);
+  GLJ_TEST(memcmp(x, RGB, sizeof(RGB)) == 0);
+  glj_ycc_rgb_rows(x, 0, Y, 0, 1, CB, CR, 0, 4, GLJ_PIXEL_BGRA);
+  for (i = 0; i < 4; i++) {
+    GLJ_TEST(x[4*i + 0] == RGB[3*i + 2]);
+    GLJ_TEST(x[4*i + 1] == RGB[3*i + 1]);
+    GLJ_TEST(x[4*i + 2] == RGB[3*i + 0]);
+    GLJ_TEST(x[4*i + 3] == 255);
+  }
+}
+
+#if defined(GLJ_HAVE_SSE2)
+/* The SIMD color conversion must give exactly the pixels of the portable
+    one, including the columns past the last whole vector. */
+static void test_ycc_rgb_sse2(void *ctx) {
+  static unsigned char y[2*80];
+  static unsigned char cb[80];
+  static unsigned char cr[80];
+  static unsigned char ref[2*80*4];
+  static unsigned char test[2*80*4];
+  int width;
+  int m;
+  (void)ctx;
+  srand(1);
+  m = 0;
+  for (width = 1; width <= 80; width++) {
+    int format;
+    int cdec;
+    int i;
+    for (i = 0; i < 2*80; i++) y[i] = rand() & 0xFF;
+    for (i = 0; i < 80; i++) {
+      cb[i] = rand() & 0xFF;
+      cr[i] = rand() & 0xFF;
+    }
+    for (format = 0; format < GLJ_PIXEL_FORMAT_MAX; format++) {
+      for (cdec = 0; cdec < 2; cdec++) {
+        memset(ref, 0, sizeof(ref));
+        memset(test, 0, sizeof(test));
+        glj_ycc_rgb_rows(ref, 80*4, y, 80, 2, cb, cr, cdec, width,
+         (glj_pixel_format)format);
+        glj_ycc_rgb_rows_sse2(test, 80*4, y, 80, 2, cb, cr, cdec, width,
+         (glj_pixel_format)format);
+        m += memcmp(ref, test, sizeof(ref)) != 0;
+      }
+    }
+  }
+  GLJ_TEST(m == 0);
+}
+#endif
+
 static glj_test TESTS[] = {
- { "Image Init 8-bit 4:2:0 Test", test_image_init_8bit_420, 0, 0 }
+ { "Image Init 8-bit 4:2:0 Test", test_image_init_8bit_420, 0, 0 },
+ { "Image Init 8-bit 4:2:0 Scaled", test_image_init_8bit_420_scaled, 0, 0 },
+ { "YCbCr to RGB Test", test_ycc_rgb, 0, 0 },
+#if defined(GLJ_HAVE_SSE2)
+ { "YCbCr to RGB SSE2 Test", test_ycc_rgb_sse2, 0, 0 }
+#endif
 };
 
 static glj_test_suite IMAGE_TEST_SUITE = {
@@ -0,0 +1,714 @@
+/* JPEG GPU project
+Copyright (c) 2014-2016 JPEG GPU project contributors.  All rights reserved.
+
+Licensed under the Apache License, Version 2.0 (the "License"); you may not
+ use this file except in compliance with the License.
+You may obtain a copy of the License at:
+
+  http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software distributed
+ under the License is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR
+ CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and limitations
+ under the License. */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <jpeglib.h>
+#include "../src/color.h"
+#include "../src/image.h"
+#include "../src/internal.h"
+#include "../src/jpeg_info.h"
+#include "../src/jpeg_wrap.h"
+#include "../src/test.h"
+#include "../src/xjpeg.h"
+
+/* The ways test_encode() can code a file besides baseline interleaved scans,
+    or'ed together */
+#define TEST_SEPARATE_SCANS (1)
+#define TEST_PROGRESSIVE (2)
+#define TEST_ARITHMETIC (4)
+
+/* Encode a width x height test image with libjpeg, gradients with noise so
+    that most blocks code AC coefficients, with 4:2:0 chroma when ncomps is 3.
+   With TEST_SEPARATE_SCANS each component is coded in a scan of its own, and
+    with TEST_PROGRESSIVE the scans of jpeg_simple_progression() are used.
+   With TEST_ARITHMETIC the scans are arithmetic coded instead of huffman.
+   Returns the jpeg file, to be freed with free(), or NULL on failure. */
+static unsigned char *test_encode(int width, int height, int ncomps,
+ int restart_interval, int coding, unsigned long *size) {
+  jpeg_scan_info scans[3];
+  struct jpeg_compress_struct cinfo;
+  struct jpeg_error_mgr jerr;
+  unsigned char *buf;
+  unsigned char *row;
+  unsigned int seed;
+  int i;
+  int j;
+  row = (unsigned char *)malloc(width*ncomps);
+  if (row == NULL) {
+    return NULL;
+  }
+  buf = NULL;
+  *size = 0;
+  cinfo.err = jpeg_std_error(&jerr);
+  jpeg_create_compress(&cinfo);
+  jpeg_mem_dest(&cinfo, &buf, size);
+  cinfo.image_width = width;
+  cinfo.image_height = height;
+  cinfo.input_components = ncomps;
+  cinfo.in_color_space = ncomps == 3 ? JCS_RGB : JCS_GRAYSCALE;
+  jpeg_set_defaults(&cinfo);
+  jpeg_set_quality(&cinfo, 90, TRUE);
+  cinfo.restart_interval = restart_interval;
+  cinfo.arith_code = (coding & TEST_ARITHMETIC) != 0;
+  if (coding & TEST_PROGRESSIVE) {
+    jpeg_simple_progression(&cinfo);
+  }
+  else if (coding & TEST_SEPARATE_SCANS) {
+    for (i = 0; i < ncomps; i++) {
+      scans[i].comps_in_scan = 1;
+      scans[i].component_index[0] = i;
+      scans[i].Ss = 0;
+      scans[i].Se = 63;
+      scans[i].Ah = 0;
+      scans[i].Al = 0;
+    }
+    cinfo.scan_info = scans;
+    cinfo.num_scans = ncomps;
+  }
+  jpeg_start_compress(&cinfo, TRUE);
+  seed = 1;
+  for (j = 0; j < height; j++) {
+    for (i = 0; i < width*ncomps; i++) {
+      seed = seed*1103515245 + 12345;
+      row[i] = (unsigned char)((i*7 + j*3 + (i % ncomps)*50 +
+       (int)(seed >> 26)) & 0xFF);
+    }
+    jpeg_write_scanlines(&cinfo, &row, 1);
+  }
+  jpeg_finish_compress(&cinfo);
+  jpeg_destroy_compress(&cinfo);
+  free(row);
+  return buf;
+}
+
+/* Allocate img for the jpeg whose headers ctx has decoded, scaled down by
+    2^scale. */
+static int test_image_init(xjpeg_decode_ctx *ctx, image *img, int scale) {
+  jpeg_header header;
+  if (xjpeg_get_header(ctx, &header) != EXIT_SUCCESS ||
+   jpeg_header_scale(&header, scale) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  ctx->scale = scale;
+  return image_init(img, &header);
+}
+
+/* Decode the jpeg in buf to out, into img allocated here.
+   When npipelined is not NULL it is set to the number of jobs the decode
+    ran through the pipeline of entropy decoding and reconstruction. */
+static int test_decode(image *img, const unsigned char *buf, int size,
+ xjpeg_decode_out out, int scale, xjpeg_idct idct, int nthreads,
+ int *npipelined) {
+  xjpeg_decode_ctx *ctx;
+  int ret;
+  memset(img, 0, sizeof(image));
+  ctx = (xjpeg_decode_ctx *)malloc(sizeof(xjpeg_decode_ctx));
+  if (ctx == NULL) {
+    return EXIT_FAILURE;
+  }
+  xjpeg_init(ctx, buf, size);
+  ctx->idct = idct;
+  ctx->nthreads = nthreads;
+  xjpeg_decode_header(ctx);
+  ret = test_image_init(ctx, img, scale);
+  if (ret == EXIT_SUCCESS) {
+    xjpeg_decode_image(ctx, img, out);
+    if (ctx->error != NULL) {
+      image_clear(img);
+      ret = EXIT_FAILURE;
+    }
+  }
+  if (npipelined != NULL) {
+    *npipelined = ctx->npipelined;
+  }
+  free(ctx);
+  return ret;
+}
+
+/* Decode the region crop of the jpeg in buf to yuv, into img allocated here,
+    expanding crop to the MCUs that are decoded. */
+static int test_decode_crop(image *img, const unsigned char *buf, int size,
+ jpeg_crop *crop, int scale, int nthreads) {
+  xjpeg_decode_ctx *ctx;
+  jpeg_header header;
+  int ret;
+  memset(img, 0, sizeof(image));
+  ctx = (xjpeg_decode_ctx *)malloc(sizeof(xjpeg_decode_ctx));
+  if (ctx == NULL) {
+    return EXIT_FAILURE;
+  }
+  xjpeg_init(ctx, buf, size);
+  ctx->idct = XJPEG_IDCT_ISLOW;
+  ctx->nthreads = nthreads;
+  xjpeg_decode_header(ctx);
+  ret = xjpeg_get_header(ctx, &header);
+  if (ret == EXIT_SUCCESS) {
+    ret = jpeg_header_crop(&header, crop);
+  }
+  if (ret == EXIT_SUCCESS) {
+    ret = jpeg_header_scale(&header, scale);
+  }
+  if (ret == EXIT_SUCCESS) {
+    ret = image_init(img, &header);
+  }
+  if (ret == EXIT_SUCCESS) {
+    int mcu_width;
+    int mcu_height;
+    mcu_width = ctx->frame.hmax << 3;
+    mcu_height = ctx->frame.vmax << 3;
+    ctx->crop.x0 = crop->x/mcu_width;
+    ctx->crop.y0 = crop->y/mcu_height;
+    ctx->crop.x1 = (crop->x + crop->width + mcu_width - 1)/mcu_width;
+    ctx->crop.y1 = (crop->y + crop->height + mcu_height - 1)/mcu_height;
+    ctx->scale = scale;
+    xjpeg_decode_image(ctx, img, XJPEG_DECODE_YUV);
+    if (ctx->error != NULL) {
+      image_clear(img);
+      ret = EXIT_FAILURE;
+    }
+  }
+  free(ctx);
+  return ret;
+}
+
+/* Return non-zero if the samples of the planes of a and b are the same. */
+static int test_planes_equal(const image *a, const image *b) {
+  int i;
+  int j;
+  if (a->nplanes != b->nplanes) {
+    return 0;
+  }
+  for (i = 0; i < a->nplanes; i++) {
+    const image_plane *pa;
+    const image_plane *pb;
+    pa = &a->plane[i];
+    pb = &b->plane[i];
+    if (pa->width != pb->width || pa->height != pb->height) {
+      return 0;
+    }
+    for (j = 0; j < pa->height; j++) {
+      if (memcmp(pa->data + j*pa->ystride, pb->data + j*pb->ystride,
+       pa->width) != 0) {
+        return 0;
+      }
+    }
+  }
+  return 1;
+}
+
+/* Return non-zero if the quantized coefficients of the blocks of the planes
+    of a and b are the same, not counting the rows of blocks the planes are
+    padded with to the size of the luma plane. */
+static int test_coef_equal(const image *a, const image *b) {
+  int i;
+  if (a->nplanes != b->nplanes) {
+    return 0;
+  }
+  for (i = 0; i < a->nplanes; i++) {
+    const image_plane *pa;
+    const image_plane *pb;
+    pa = &a->plane[i];
+    pb = &b->plane[i];
+    if (pa->width != pb->width || pa->height != pb->height ||
+     memcmp(pa->coef, pb->coef,
+     (pa->width >> 3)*(pa->height >> 3)*64*sizeof(short)) != 0) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/* Push the jpeg to the streaming decoder in chunks of chunk bytes. */
+static int test_stream(image *img, const unsigned char *buf, int size,
+ int chunk, int scale, xjpeg_idct idct) {
+  xjpeg_decode_ctx *ctx;
+  int have;
+  int pos;
+  int ret;
+  memset(img, 0, sizeof(image));
+  ctx = (xjpeg_decode_ctx *)malloc(sizeof(xjpeg_decode_ctx));
+  if (ctx == NULL || xjpeg_stream_init(ctx) != EXIT_SUCCESS) {
+    free(ctx);
+    return EXIT_FAILURE;
+  }
+  ctx->idct = idct;
+  ctx->nthreads = 1;
+  have = 0;
+  ret = EXIT_SUCCESS;
+  for (pos = 0; pos < size && ret == EXIT_SUCCESS; pos += chunk) {
+    if (xjpeg_stream_push(ctx, buf + pos, GLJ_MINI(chunk, size - pos)) !=
+     EXIT_SUCCESS) {
+      ret = EXIT_FAILURE;
+      break;
+    }
+    if (!have && xjpeg_stream_header(ctx)) {
+      ret = test_image_init(ctx, img, scale);
+      have = ret == EXIT_SUCCESS;
+    }
+    if (have) {
+      xjpeg_stream_image(ctx, img, XJPEG_DECODE_YUV);
+    }
+    if (ctx->error != NULL) {
+      ret = EXIT_FAILURE;
+    }
+  }
+  if (!have) {
+    ret = EXIT_FAILURE;
+  }
+  else if (ret != EXIT_SUCCESS) {
+    image_clear(img);
+  }
+  xjpeg_stream_clear(ctx);
+  free(ctx);
+  return ret;
+}
+
+/* Streamed data runs out in the middle of blocks, so the decoder reads zero
+    bits past the end of what it has, which must not index outside a block
+    for any inverse DCT. */
+static void test_stream_yuv(void *ctx) {
+  static const int CHUNKS[] = { 1, 8, 61 };
+  unsigned char *buf;
+  unsigned long size;
+  int idct;
+  int scale;
+  int k;
+  (void)ctx;
+  buf = test_encode(96, 80, 3, 0, 0, &size);
+  GLJ_TEST(buf != NULL);
+  if (buf == NULL) {
+    return;
+  }
+  for (idct = 0; idct < XJPEG_IDCT_MAX; idct++) {
+    for (scale = 0; scale < 2; scale++) {
+      image ref;
+      GLJ_TEST(test_decode(&ref, buf, size, XJPEG_DECODE_YUV, scale,
+       (xjpeg_idct)idct, 1, NULL) == EXIT_SUCCESS);
+      for (k = 0; k < (int)(sizeof(CHUNKS)/sizeof(*CHUNKS)); k++) {
+        image img;
+        GLJ_TEST(test_stream(&img, buf, size, CHUNKS[k], scale,
+         (xjpeg_idct)idct) == EXIT_SUCCESS);
+        GLJ_TEST(test_planes_equal(&ref, &img));
+        image_clear(&img);
+      }
+      image_clear(&ref);
+    }
+  }
+  free(buf);
+}
+
+/* Decoding to the same image again, as jpeg_gpu does every frame, must give
+    the same packed values, including those of scans that are deferred. */
+static void test_pack_again(void *ctx) {
+  xjpeg_decode_ctx *dec;
+  unsigned char *buf;
+  unsigned long size;
+  image img;
+  short *coef;
+  int *index;
+  int packed[NPLANES_MAX];
+  int total;
+  int nblocks;
+  int i;
+  int k;
+  (void)ctx;
+  buf = test_encode(96, 80, 3, 0, TEST_SEPARATE_SCANS, &size);
+  dec = (xjpeg_decode_ctx *)malloc(sizeof(xjpeg_decode_ctx));
+  GLJ_TEST(buf != NULL && dec != NULL);
+  if (buf == NULL || dec == NULL) {
+    free(dec);
+    free(buf);
+    return;
+  }
+  coef = NULL;
+  index = NULL;
+  total = 0;
+  nblocks = 0;
+  for (k = 0; k < 3; k++) {
+    xjpeg_init(dec, buf, size);
+    xjpeg_decode_header(dec);
+    if (k == 0) {
+      GLJ_TEST(test_image_init(dec, &img, 0) == EXIT_SUCCESS);
+    }
+    xjpeg_decode_image(dec, &img, XJPEG_DECODE_PACK);
+    GLJ_TEST(dec->error == NULL);
+    if (k == 0) {
+      for (i = 0; i < img.nplanes; i++) {
+        packed[i] = img.plane[i].packed;
+        total += packed[i];
+        nblocks += ((img.plane[i].width >> 3) << img.plane[i].xdec)*
+         img.plane[i].cstride;
+      }
+      coef = (short *)malloc(total*sizeof(short));
+      index = (int *)malloc(nblocks*sizeof(int));
+      GLJ_TEST(coef != NULL && index != NULL);
+      if (coef == NULL || index == NULL) {
+        break;
+      }
+      memcpy(coef, img.coef, total*sizeof(short));
+      memcpy(index, img.index, nblocks*sizeof(int));
+      continue;
+    }
+    for (i = 0; i < img.nplanes; i++) {
+      GLJ_TEST(img.plane[i].packed == packed[i]);
+    }
+    GLJ_TEST(memcmp(coef, img.coef, total*sizeof(short)) == 0);
+    GLJ_TEST(memcmp(index, img.index, nblocks*sizeof(int)) == 0);
+  }
+  free(index);
+  free(coef);
+  image_clear(&img);
+  free(dec);
+  free(buf);
+}
+
+/* Pad the jpeg file in buf with zeros after its EOI marker to size bytes. */
+static unsigned char *test_pad(unsigned char *buf, unsigned long *size,
+ unsigned long to) {
+  unsigned char *pad;
+  if (buf == NULL || *size >= to) {
+    return buf;
+  }
+  pad = (unsigned char *)realloc(buf, to);
+  if (pad == NULL) {
+    free(buf);
+    return NULL;
+  }
+  memset(pad + *size, 0, to - *size);
+  *size = to;
+  return pad;
+}
+
+/* An index saved for one file must not be used for another of the same
+    size, here one with the same number of MCUs padded after its EOI marker,
+    but be rebuilt for it instead. */
+static void test_stale_index(void *ctx) {
+  static const char *NAME = "xjpeg_test.idx";
+  xjpeg_decode_ctx *dec;
+  xjpeg_index index;
+  jpeg_info info;
+  unsigned char *a;
+  unsigned char *b;
+  unsigned long asize;
+  unsigned long bsize;
+  image ref;
+  image img;
+  (void)ctx;
+  a = test_encode(96, 80, 3, 0, 0, &asize);
+  b = test_encode(80, 96, 3, 0, 0, &bsize);
+  a = test_pad(a, &asize, bsize);
+  b = test_pad(b, &bsize, asize);
+  dec = (xjpeg_decode_ctx *)malloc(sizeof(xjpeg_decode_ctx));
+  GLJ_TEST(a != NULL && b != NULL && dec != NULL);
+  if (a == NULL || b == NULL || dec == NULL) {
+    free(dec);
+    free(b);
+    free(a);
+    return;
+  }
+  GLJ_TEST(xjpeg_index_build(&index, a, asize, 0) == EXIT_SUCCESS);
+  GLJ_TEST(xjpeg_index_save(&index, NAME) == EXIT_SUCCESS);
+  GLJ_TEST(!xjpeg_index_match(&index, b, bsize));
+  xjpeg_index_clear(&index);
+  info.size = bsize;
+  info.buf = b;
+  info.mapped = 0;
+  memset(&img, 0, sizeof(image));
+  xjpeg_init(dec, b, bsize);
+  dec->nthreads = 2;
+  GLJ_TEST(xjpeg_use_index(dec, &info, NAME) == EXIT_SUCCESS);
+  if (dec->index != NULL) {
+    GLJ_TEST(xjpeg_index_match(dec->index, b, bsize));
+    xjpeg_decode_header(dec);
+    GLJ_TEST(test_image_init(dec, &img, 0) == EXIT_SUCCESS);
+    xjpeg_decode_image(dec, &img, XJPEG_DECODE_YUV);
+    GLJ_TEST(dec->error == NULL);
+    GLJ_TEST(test_decode(&ref, b, bsize, XJPEG_DECODE_YUV, 0,
+     XJPEG_IDCT_FLOAT, 1, NULL) == EXIT_SUCCESS);
+    GLJ_TEST(test_planes_equal(&ref, &img));
+    image_clear(&ref);
+    image_clear(&img);
+    xjpeg_index_clear(dec->index);
+    free(dec->index);
+  }
+  /* The rebuilt index replaced the stale one in the file */
+  GLJ_TEST(xjpeg_index_load(&index, NAME) == EXIT_SUCCESS);
+  GLJ_TEST(xjpeg_index_match(&index, b, bsize));
+  xjpeg_index_clear(&index);
+  remove(NAME);
+  free(dec);
+  free(b);
+  free(a);
+}
+
+/* Pixels decoded with rows pstride bytes apart must be those decoded packed,
+    leaving the bytes between rows untouched. */
+static void test_pixel_stride(void *ctx) {
+  xjpeg_decode_ctx *dec;
+  int ncomps;
+  int format;
+  (void)ctx;
+  dec = (xjpeg_decode_ctx *)malloc(sizeof(xjpeg_decode_ctx));
+  GLJ_TEST(dec != NULL);
+  if (dec == NULL) {
+    return;
+  }
+  for (ncomps = 1; ncomps <= 3; ncomps += 2) {
+    unsigned char *buf;
+    unsigned long size;
+    buf = test_encode(93, 77, ncomps, 0, 0, &size);
+    GLJ_TEST(buf != NULL);
+    if (buf == NULL) {
+      continue;
+    }
+    for (format = 0; format < GLJ_PIXEL_FORMAT_MAX; format++) {
+      xjpeg_decode_out out;
+      image ref;
+      image img;
+      int width;
+      int pstride;
+      int j;
+      out = (xjpeg_decode_out)(XJPEG_DECODE_RGB + format);
+      GLJ_TEST(test_decode(&ref, buf, size, out, 0, XJPEG_IDCT_FLOAT, 1,
+       NULL) == EXIT_SUCCESS);
+      width = ref.width*(ncomps == 1 && format == GLJ_PIXEL_RGB ? 1 :
+       GLJ_PIXEL_SIZE[format]);
+      pstride = ref.width*4 + 13;
+      xjpeg_init(dec, buf, size);
+      dec->nthreads = 1;
+      xjpeg_decode_header(dec);
+      GLJ_TEST(test_image_init(dec, &img, 0) == EXIT_SUCCESS);
+      GLJ_TEST(image_set_pstride(&img, pstride) == EXIT_SUCCESS);
+      memset(img.pixels, 0xA5, pstride*img.height);
+      xjpeg_decode_image(dec, &img, out);
+      GLJ_TEST(dec->error == NULL);
+      for (j = 0; j < img.height; j++) {
+        unsigned char *row;
+        int pad;
+        int i;
+        row = img.pixels + j*pstride;
+        GLJ_TEST(memcmp(row, ref.pixels + j*width, width) == 0);
+        pad = 0;
+        for (i = width; i < pstride; i++) {
+          pad += row[i] == 0xA5;
+        }
+        GLJ_TEST(pad == pstride - width);
+      }
+      /* A stride shorter than a row of pixels is an error */
+      GLJ_TEST(image_set_pstride(&img, width - 1) == EXIT_SUCCESS);
+      xjpeg_init(dec, buf, size);
+      dec->nthreads = 1;
+      xjpeg_decode_header(dec);
+      xjpeg_decode_image(dec, &img, out);
+      GLJ_TEST(dec->error != NULL);
+      image_clear(&img);
+      image_clear(&ref);
+    }
+    free(buf);
+  }
+  free(dec);
+}
+
+/* Decoding yuv on any number of threads must give the samples of the serial
+    decode, also when a job is pipelined, which a small scan with no restart
+    markers, or fewer restart intervals than threads, is. */
+static void test_pipelined_yuv(void *ctx) {
+  static const int INTERVALS[] = { 0, 12 };
+  static const int NTHREADS[] = { 2, 3, 4, 8 };
+  int n;
+  (void)ctx;
+  for (n = 0; n < (int)(sizeof(INTERVALS)/sizeof(*INTERVALS)); n++) {
+    unsigned char *buf;
+    unsigned long size;
+    int idct;
+    int scale;
+    int k;
+    buf = test_encode(96, 80, 3, INTERVALS[n], 0, &size);
+    GLJ_TEST(buf != NULL);
+    if (buf == NULL) {
+      continue;
+    }
+    for (idct = 0; idct < XJPEG_IDCT_MAX; idct++) {
+      for (scale = 0; scale < 3; scale++) {
+        image ref;
+        int npipelined;
+        GLJ_TEST(test_decode(&ref, buf, size, XJPEG_DECODE_YUV, scale,
+         (xjpeg_idct)idct, 1, &npipelined) == EXIT_SUCCESS);
+        GLJ_TEST(npipelined == 0);
+        for (k = 0; k < (int)(sizeof(NTHREADS)/sizeof(*NTHREADS)); k++) {
+          image img;
+          GLJ_TEST(test_decode(&img, buf, size, XJPEG_DECODE_YUV, scale,
+           (xjpeg_idct)idct, NTHREADS[k], &npipelined) == EXIT_SUCCESS);
+          /* The 3 restart intervals have 2 threads each from 8 */
+          GLJ_TEST(npipelined == (INTERVALS[n] == 0 ? 1 :
+           NTHREADS[k] >= 6 ? 3 : 0));
+          GLJ_TEST(test_planes_equal(&ref, &img));
+          image_clear(&img);
+        }
+        image_clear(&ref);
+      }
+    }
+    free(buf);
+  }
+}
+
+/* A file coded other than baseline must decode to the quantized coefficients
+    and islow yuv samples of the same image coded baseline, serially and on
+    threads, with and without restart markers. */
+static void test_coding(int coding) {
+  static const xjpeg_decode_out OUTS[] = {
+    XJPEG_DECODE_QUANT, XJPEG_DECODE_YUV
+  };
+  static const int INTERVALS[] = { 0, 3 };
+  int ncomps;
+  int n;
+  for (ncomps = 1; ncomps <= 3; ncomps += 2) {
+    for (n = 0; n < (int)(sizeof(INTERVALS)/sizeof(*INTERVALS)); n++) {
+      unsigned char *base;
+      unsigned char *buf;
+      unsigned long bsize;
+      unsigned long size;
+      int k;
+      int nthreads;
+      base = test_encode(93, 77, ncomps, INTERVALS[n], 0, &bsize);
+      buf = test_encode(93, 77, ncomps, INTERVALS[n], coding, &size);
+      GLJ_TEST(base != NULL && buf != NULL);
+      if (base == NULL || buf == NULL) {
+        free(buf);
+        free(base);
+        continue;
+      }
+      for (k = 0; k < (int)(sizeof(OUTS)/sizeof(*OUTS)); k++) {
+        image ref;
+        GLJ_TEST(test_decode(&ref, base, bsize, OUTS[k], 0,
+         XJPEG_IDCT_ISLOW, 1, NULL) == EXIT_SUCCESS);
+        for (nthreads = 1; nthreads <= 3; nthreads += 2) {
+          image img;
+          GLJ_TEST(test_decode(&img, buf, size, OUTS[k], 0,
+           XJPEG_IDCT_ISLOW, nthreads, NULL) == EXIT_SUCCESS);
+          GLJ_TEST(OUTS[k] == XJPEG_DECODE_QUANT ? test_coef_equal(&ref, &img) :
+           test_planes_equal(&ref, &img));
+          image_clear(&img);
+        }
+        image_clear(&ref);
+      }
+      free(buf);
+      free(base);
+    }
+  }
+}
+
+static void test_progressive(void *ctx) {
+  (void)ctx;
+  test_coding(TEST_PROGRESSIVE);
+}
+
+static void test_arithmetic(void *ctx) {
+  (void)ctx;
+  test_coding(TEST_ARITHMETIC);
+  test_coding(TEST_ARITHMETIC | TEST_PROGRESSIVE);
+}
+
+/* A cropped decode must give the samples of the rows and columns of a full
+    decode under the MCUs of the crop region. */
+static void test_crop(void *ctx) {
+  static const jpeg_crop CROPS[] = {
+    { 0, 0, 93, 77 }, { 17, 9, 30, 40 }, { 48, 32, 45, 45 }, { 80, 70, 5, 5 }
+  };
+  static const int INTERVALS[] = { 0, 2 };
+  int n;
+  (void)ctx;
+  for (n = 0; n < (int)(sizeof(INTERVALS)/sizeof(*INTERVALS)); n++) {
+    unsigned char *buf;
+    unsigned long size;
+    int scale;
+    int nthreads;
+    int k;
+    buf = test_encode(93, 77, 3, INTERVALS[n], 0, &size);
+    GLJ_TEST(buf != NULL);
+    if (buf == NULL) {
+      continue;
+    }
+    for (scale = 0; scale < 2; scale++) {
+      image ref;
+      GLJ_TEST(test_decode(&ref, buf, size, XJPEG_DECODE_YUV, scale,
+       XJPEG_IDCT_ISLOW, 1, NULL) == EXIT_SUCCESS);
+      for (k = 0; k < (int)(sizeof(CROPS)/sizeof(*CROPS)); k++) {
+        for (nthreads = 1; nthreads <= 3; nthreads += 2) {
+          jpeg_crop crop;
+          image img;
+          int i;
+          int j;
+          crop = CROPS[k];
+          GLJ_TEST(test_decode_crop(&img, buf, size, &crop, scale,
+           nthreads) == EXIT_SUCCESS);
+          GLJ_TEST(img.nplanes == ref.nplanes);
+          for (i = 0; i < img.nplanes && i < ref.nplanes; i++) {
+            const image_plane *pr;
+            const image_plane *pi;
+            int x;
+            int y;
+            pr = &ref.plane[i];
+            pi = &img.plane[i];
+            /* jpeg_header_crop() expanded crop to whole MCUs */
+            x = (crop.x >> pi->xdec) >> scale;
+            y = (crop.y >> pi->ydec) >> scale;
+            GLJ_TEST(x + pi->width <= pr->width &&
+             y + pi->height <= pr->height);
+            if (x + pi->width > pr->width || y + pi->height > pr->height) {
+              continue;
+            }
+            for (j = 0; j < pi->height; j++) {
+              GLJ_TEST(memcmp(pi->data + j*pi->ystride,
+               pr->data + (y + j)*pr->ystride + x, pi->width) == 0);
+            }
+          }
+          image_clear(&img);
+        }
+      }
+      image_clear(&ref);
+    }
+    free(buf);
+  }
+}
+
+static glj_test TESTS[] = {
+ { "Streamed YUV Test", test_stream_yuv, 0, 0 },
+ { "Pack Decoded Again Test", test_pack_again, 0, 0 },
+ { "Stale Index Test", test_stale_index, 0, 0 },
+ { "Pixel Stride Test", test_pixel_stride, 0, 0 },
+ { "Pipelined YUV Test", test_pipelined_yuv, 0, 0 },
+ { "Progressive Test", test_progressive, 0, 0 },
+ { "Arithmetic Test", test_arithmetic, 0, 0 },
+ { "Crop Test", test_crop, 0, 0 }
+};
+
+static glj_test_suite XJPEG_TEST_SUITE = {
+  NULL,
+  NULL,
+  TESTS,
+  sizeof(TESTS)/sizeof(*TESTS)
+};
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+  if (glj_test_suite_run(&XJPEG_TEST_SUITE, NULL) != EXIT_SUCCESS) {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}